@@ -0,0 +1,89 @@
+//=============================================================================
+//	FILE:					anim.h
+//	SYSTEM:
+//	DESCRIPTION:	Sprite animation clips, frames worked out from a global tick when drawn
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_ANIM_H
+#define GUARD_BEEKIND_ANIM_H
+
+#include <array>
+#include <cstdint>
+
+#define ANIMTICKS 8 // Updates each frame is shown for
+#define ANIMNONE 0xff // Not animated
+
+// Animation clip, frames are consecutive tile ids starting from the first
+struct animclip
+{
+	uint8_t first; // Tile id of the first frame, chars which play the clip keep this as their id
+	uint8_t frames; // Number of frames
+	uint8_t ticks; // Updates each frame is shown for
+};
+
+// Clips, chars first so their ids can be looked up
+#define ANIMBEE 0
+#define ANIMZOMBEE 1
+#define ANIMGRUB 2
+#define ANIMCHARS 3 // Clips played by chars
+#define ANIMWALK 3 // Player walking
+#define ANIMGUNWALK 4 // Player walking with the gun
+
+static constexpr struct animclip sg_animclips[]=
+{
+	{51, 2, ANIMTICKS},
+	{53, 2, ANIMTICKS},
+	{55, 2, ANIMTICKS},
+	{45, 2, ANIMTICKS},
+	{40, 3, ANIMTICKS},
+};
+
+// Clip played by chars of each tile id (any of the clip's frames), ANIMNONE for those which don't animate
+constexpr std::array<uint8_t, 256>
+anim_charclips()
+{
+	std::array<uint8_t, 256> clips={};
+
+	for (uint32_t id=0; id<clips.size(); id++)
+		clips[id]=ANIMNONE;
+
+	for (uint8_t clip=0; clip<ANIMCHARS; clip++)
+		for (uint8_t frame=0; frame<sg_animclips[clip].frames; frame++)
+			clips[sg_animclips[clip].first+frame]=clip;
+
+	return clips;
+}
+
+static constexpr std::array<uint8_t, 256> sg_animcharclips=anim_charclips();
+
+// Tile id for a char to keep while playing its clip, which is the first frame
+constexpr uint8_t
+anim_charid(const uint8_t id)
+{
+	return (sg_animcharclips[id]==ANIMNONE)?id:sg_animclips[sg_animcharclips[id]].first;
+}
+
+// Frame of a clip to show at tick, phase offsets it by whole frames
+constexpr uint8_t
+anim_frame(const uint8_t clip, const uint32_t tick, const uint8_t phase)
+{
+	return sg_animclips[clip].first+(((tick/sg_animclips[clip].ticks)+phase)%sg_animclips[clip].frames);
+}
+
+// Frame for a char to show at tick, being its id when it doesn't animate
+constexpr uint8_t
+anim_charframe(const uint8_t id, const uint32_t tick, const uint8_t phase)
+{
+	return (sg_animcharclips[id]==ANIMNONE)?id:anim_frame(sg_animcharclips[id], tick, phase);
+}
+
+// Phase for a char, from where it starts so neighbours don't all move in step
+constexpr uint8_t
+anim_phase(const int32_t tilex, const int32_t tiley)
+{
+	return (uint8_t)((tilex+tiley)&0xff);
+}
+
+#endif // ! defined GUARD_BEEKIND_ANIM_H
@@ -0,0 +1,150 @@
+//=============================================================================
+//	FILE:					counters.h
+//	SYSTEM:
+//	DESCRIPTION:	Per-frame event counters for hot paths
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_COUNTERS_H
+#define GUARD_BEEKIND_COUNTERS_H
+
+#include <cstdint>
+
+// Events which are counted
+enum countertype
+{
+	COUNTER_PATHFINDER, // pathfinder() calls
+	COUNTER_PATHNODES, // nodes expanded by pathfinder()
+	COUNTER_PATHFAILED, // pathfinder() calls which found no path
+	COUNTER_COLLIDE, // collide() calls
+	COUNTER_OVERLAP, // overlap() calls
+	COUNTER_COUNTCHARS, // countchars() scans
+	COUNTER_FINDNEAREST, // findnearestchar() scans
+	COUNTER_PARTICLES, // particles alive at end of frame
+	COUNTER_ERASED, // chars/shots/particles erased
+	COUNTER_ALLOCS, // heap allocations, when the host counts them
+	COUNTER_AIDECISIONS, // agents making decisions (targets, re-paths, overlap scans)
+	COUNTER_AIDEFERRED, // far agents put off to a later update by the decision budget
+	COUNTER_REPLANS, // paths planned by agents heading for a new target
+
+	COUNTER_COUNT
+};
+
+// Short names for the overlay
+static const char * const sg_counternames[COUNTER_COUNT] =
+{
+	"PATH", "NODE", "PFAIL", "COLL", "OVLP",
+	"CNT", "NEAR", "PART", "ERAS", "ALOC",
+	"AIDC", "AIDF", "RPLN"
+};
+
+#define COUNTERHISTORY 128 // Frames of history kept for the rolling average and peak
+
+struct counters
+{
+	uint32_t current[COUNTER_COUNT]; // Counts so far this frame
+	uint32_t last[COUNTER_COUNT]; // Counts for the last complete frame
+	uint32_t history[COUNTER_COUNT][COUNTERHISTORY]; // Counts for previous frames
+	uint32_t pos; // Next history slot to write
+	uint32_t count; // Number of history slots filled
+	uint64_t frames; // Number of complete frames
+};
+
+// Counters for the game currently being run on this thread, each thread only
+// runs one game at a time so counting doesn't need the game passing around
+extern thread_local struct counters *sg_counters;
+
+inline void
+counter_add(const countertype type, const uint32_t count=1)
+{
+	if (sg_counters!=nullptr)
+		sg_counters->current[type]+=count;
+}
+
+// Set a value which is a level rather than a count of events
+inline void
+counter_set(const countertype type, const uint32_t value)
+{
+	if (sg_counters!=nullptr)
+		sg_counters->current[type]=value;
+}
+
+inline void
+counters_reset(struct counters & c)
+{
+	for (int i=0; i<COUNTER_COUNT; i++)
+	{
+		c.current[i]=0;
+		c.last[i]=0;
+
+		for (int j=0; j<COUNTERHISTORY; j++)
+			c.history[i][j]=0;
+	}
+
+	c.pos=0;
+	c.count=0;
+	c.frames=0;
+}
+
+// Move the current frame into the history, ready for the next frame
+inline void
+counters_endframe(struct counters & c)
+{
+	for (int i=0; i<COUNTER_COUNT; i++)
+	{
+		c.last[i]=c.current[i];
+		c.history[i][c.pos]=c.current[i];
+		c.current[i]=0;
+	}
+
+	c.pos=(c.pos+1)%COUNTERHISTORY;
+	if (c.count<COUNTERHISTORY) c.count++;
+	c.frames++;
+}
+
+// Average per frame over the history
+inline uint32_t
+counter_average(const struct counters & c, const countertype type)
+{
+	uint64_t total=0;
+
+	if (c.count==0)
+		return 0;
+
+	for (uint32_t i=0; i<c.count; i++)
+		total+=c.history[type][i];
+
+	return total/c.count;
+}
+
+// Highest count for any frame in the history
+inline uint32_t
+counter_peak(const struct counters & c, const countertype type)
+{
+	uint32_t peak=0;
+
+	for (uint32_t i=0; i<c.count; i++)
+		if (c.history[type][i]>peak) peak=c.history[type][i];
+
+	return peak;
+}
+
+// Bind a game's counters to this thread for the enclosing scope
+struct countersscope
+{
+	struct counters *previous;
+
+	countersscope(struct counters & c) :
+		previous(sg_counters)
+	{
+		sg_counters=&c;
+	}
+
+	~countersscope()
+	{
+		sg_counters=previous;
+	}
+};
+
+#endif // ! defined GUARD_BEEKIND_COUNTERS_H
@@ -0,0 +1,156 @@
+//=============================================================================
+//	FILE:					fixed.h
+//	SYSTEM:
+//	DESCRIPTION:	Fixed point numbers, and the real type physics is done in
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_FIXED_H
+#define GUARD_BEEKIND_FIXED_H
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#define FIXEDFRAC 8 // Fraction bits of real, 24.8 reaches past the widest level (65535 tiles of 16 pixels)
+
+// Signed fixed point number with FRAC fraction bits held in 32 bits. Whole numbers and float constants
+// convert in implicitly (at compile time when constant), converting out is explicit
+template<int FRAC>
+struct fixedpoint
+{
+	static constexpr int32_t ONE=(1<<FRAC);
+
+	int32_t raw;
+
+	constexpr fixedpoint() : raw(0) {}
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type=0>
+	constexpr fixedpoint(const T value) : raw((int32_t)(value*ONE)) {}
+
+	// Rounds to the nearest step
+	template<typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type=0>
+	constexpr fixedpoint(const T value) : raw((int32_t)((value*ONE)+((value<0)?-0.5:0.5))) {}
+
+	static constexpr fixedpoint
+	fromraw(const int32_t value)
+	{
+		fixedpoint f;
+
+		f.raw=value;
+
+		return f;
+	}
+
+	// Towards zero, as for a float
+	explicit constexpr operator int() const { return raw/ONE; }
+	explicit constexpr operator float() const { return (float)raw/ONE; }
+	explicit constexpr operator double() const { return (double)raw/ONE; }
+
+	constexpr fixedpoint operator-() const { return fromraw(-raw); }
+
+	friend constexpr fixedpoint operator+(const fixedpoint a, const fixedpoint b) { return fromraw(a.raw+b.raw); }
+	friend constexpr fixedpoint operator-(const fixedpoint a, const fixedpoint b) { return fromraw(a.raw-b.raw); }
+	friend constexpr fixedpoint operator*(const fixedpoint a, const fixedpoint b) { return fromraw((int32_t)(((int64_t)a.raw*b.raw)>>FRAC)); }
+	friend constexpr fixedpoint operator/(const fixedpoint a, const fixedpoint b) { return fromraw((int32_t)(((int64_t)a.raw*ONE)/b.raw)); }
+
+	constexpr fixedpoint & operator+=(const fixedpoint b) { raw+=b.raw; return *this; }
+	constexpr fixedpoint & operator-=(const fixedpoint b) { raw-=b.raw; return *this; }
+	constexpr fixedpoint & operator*=(const fixedpoint b) { return (*this=(*this)*b); }
+	constexpr fixedpoint & operator/=(const fixedpoint b) { return (*this=(*this)/b); }
+
+	friend constexpr bool operator==(const fixedpoint a, const fixedpoint b) { return (a.raw==b.raw); }
+	friend constexpr bool operator!=(const fixedpoint a, const fixedpoint b) { return (a.raw!=b.raw); }
+	friend constexpr bool operator<(const fixedpoint a, const fixedpoint b) { return (a.raw<b.raw); }
+	friend constexpr bool operator<=(const fixedpoint a, const fixedpoint b) { return (a.raw<=b.raw); }
+	friend constexpr bool operator>(const fixedpoint a, const fixedpoint b) { return (a.raw>b.raw); }
+	friend constexpr bool operator>=(const fixedpoint a, const fixedpoint b) { return (a.raw>=b.raw); }
+
+	friend constexpr fixedpoint floor(const fixedpoint a) { return fromraw(a.raw&~(ONE-1)); }
+	friend constexpr fixedpoint abs(const fixedpoint a) { return fromraw((a.raw<0)?-a.raw:a.raw); }
+};
+
+// Integer square root, the largest r with r*r <= n
+constexpr uint64_t
+fixed_isqrt(const uint64_t n)
+{
+	uint64_t r=0;
+	uint64_t bit=(uint64_t)1<<62;
+
+	while (bit>n)
+		bit>>=2;
+
+	uint64_t rem=n;
+
+	while (bit!=0)
+	{
+		if (rem>=(r+bit))
+		{
+			rem-=(r+bit);
+			r=(r>>1)+bit;
+		}
+		else
+			r>>=1;
+
+		bit>>=2;
+	}
+
+	return r;
+}
+
+static_assert(fixed_isqrt(1000000)==1000, "fixed_isqrt is wrong");
+static_assert(fixed_isqrt(999999)==999, "fixed_isqrt is wrong");
+
+// Length of the hypotenuse to the nearest step, worked out in 64 bits so it holds for any distance
+// across a level
+template<int FRAC>
+constexpr fixedpoint<FRAC>
+fixed_hypot(const fixedpoint<FRAC> a, const fixedpoint<FRAC> b)
+{
+	int64_t x=a.raw;
+	int64_t y=b.raw;
+	uint64_t n=(uint64_t)((x*x)+(y*y));
+	uint64_t r;
+
+	// The bitwise root is slow in the AI's distance checks, so at run time start from the double root
+	// and step it onto the exact one, which gives the same result on any machine
+	if (std::is_constant_evaluated())
+		r=fixed_isqrt(n);
+	else
+	{
+		r=(uint64_t)std::sqrt((double)n);
+
+		while ((r*r)>n)
+			r--;
+
+		while (((r+1)*(r+1))<=n)
+			r++;
+	}
+
+	// Round up when n is past the midpoint (r+0.5)^2, which is r*r+r+0.25
+	if ((n-(r*r))>r)
+		r++;
+
+	return fixedpoint<FRAC>::fromraw((int32_t)r);
+}
+
+static_assert(fixed_hypot(fixedpoint<8>(3), fixedpoint<8>(4))==fixedpoint<8>(5), "fixed_hypot is wrong");
+
+inline float
+fixed_hypot(const float a, const float b)
+{
+	return sqrt((a*a)+(b*b));
+}
+
+// Physics (player, chars, shots, particles and the camera) is done in real, which is fixed point unless
+// built with BEEKIND_FLOAT_PHYSICS to compare against floats for drift
+#if defined(BEEKIND_FLOAT_PHYSICS)
+typedef float real;
+#define REALFRAC 0 // Floats, kept in snapshots so they're only restored into the same kind of build
+#else
+typedef fixedpoint<FIXEDFRAC> real;
+#define REALFRAC FIXEDFRAC
+#endif
+
+#endif // ! defined GUARD_BEEKIND_FIXED_H
@@ -0,0 +1,3452 @@
+//=============================================================================
+//	FILE:					game.cpp
+//	SYSTEM:
+//	DESCRIPTION:
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include "game_config.h"
+#include "platform.h"
+#include "game.h"
+#include "replay.h"
+#include "counters.h"
+#include "governor.h"
+#include "savestate.h"
+#include "trace.h"
+#include "workpool.h"
+#include "anim.h"
+#include "particles.h"
+
+#include "levels.h"
+#include "levelpack.h"
+#include "leveldata.h"
+#include "tilemap.h"
+#include "levelprep.h"
+#include "font.h"
+
+// Global constants
+#define FPS 30
+
+#define XMAX 320
+#define YMAX 240
+#define TILESIZE 16
+#define TILESPERROW 10
+#define BLACKCOLOUR 0, 0, 0
+#define BGCOLOUR 252,223,205
+#define DEBUGTXTCOLOUR 0, 0, 0, 128
+
+
+#define STATEINTRO 0
+#define STATEMENU 1
+#define STATEPLAYING 2
+#define STATENEWLEVEL 3
+#define STATECOMPLETE 4
+
+// Scripted sequences
+#define SEQUENCEINTRO 1
+#define SEQUENCELEVELSTART 2
+#define SEQUENCEENDGAME 3
+#define INTROFRAMES (10*FPS)
+#define ENDGAMEFRAMES (10*FPS)
+
+#define REPLAYOFF 0
+#define REPLAYRECORD 1
+#define REPLAYPLAY 2
+
+#define HEALTHZOMBEE 10
+#define HEALTHGRUB 5
+#define HEALTHPLANT 2
+#define GROWTIME (15*FPS)
+#define SPEEDBEE 0.5
+#define SPEEDZOMBEE 0.25
+#define SPEEDGRUB 0.25
+
+#define SPAWNTIME (8*FPS)
+#define MAXFLIES 15
+#define MAXBEES 20
+
+// Decision scheduling of agents away from the view
+#define AIBUCKETS 4 // Far agents decide once every this many updates, in round robin buckets
+#define AIBUDGET 64 // Most decisions made by far agents in one update
+#define AIMARGIN (4*TILESIZE) // Distance beyond the view which still counts as near
+
+// Retargeting hysteresis
+#define RETARGETDRIFT (2*TILESIZE) // Distance a target can move from where a path was planned to, before re-pathing
+#define RETARGETMARGIN (2*TILESIZE) // How much nearer another target has to be to switch to it
+
+// What an agent intends to do to another char
+#define AINONE 0 // Nothing
+#define AIPOLLINATE 1 // Bee takes pollen from a flower
+#define AIDEPOSIT 2 // Bee leaves its pollen at a hive
+#define AISTEAL 3 // Zombee steals pollen from a bee
+#define AIBREAK 4 // Zombee breaks a hive
+#define AIEAT 5 // Grub eats a toadstool
+
+#define AICHUNK 32 // Agents decided in each chunk of work shared between workers
+
+// Stress test populations selected on the cabinet (DIPSW1 + UP while a level loads)
+#define STRESSBEES 250
+#define STRESSZOMBEES 100
+#define STRESSGRUBS 100
+#define STRESSPLANTS 100
+
+// Tiles list
+//
+// blanks
+//   14, 17
+// switcheroo
+//   0
+// JS13k logo
+//   10
+// clouds
+//   1, 2 (big)
+//   11 (small)
+//   12 (double)
+// lines
+//   3 (top left)
+//   4 (top)
+//   5 (top right)
+//   13 (left)
+//   15 (right)
+//   6 (earth top left)
+//   7 (earth top)
+//   8 (earth top right)
+//   9 (small top fade)
+//   16 (left fade)
+//   18 (right fade)
+//   19 (small top)
+//   20 (thick top 1)
+//   21 (thick top 2)
+//   22 (thick top 3)
+//   23 (bottom left)
+//   24 (bottom right)
+//   25 (earth bottom left)
+//   26 (earth bottom right)
+//   27 (top left fade)
+//   28 (top right fade)
+//   29 (small bottom fade)
+// toadstool
+//   30 (tall)
+//   31 (short)
+// flower
+//   32 (double)
+//   33
+// plant
+//   34 (double)
+//   35 (tall)
+// hive
+//   36
+//   37 (broken)
+// tree
+//   38 (big crown)
+//   39 (dual branch)
+//   47 (branch left)
+//   48 (trunk)
+//   49 (branch right)
+//   57 (root left)
+//   58 (root)
+//   59 (root right)
+// gun
+//   50
+// bee
+//   51, 52
+// zombee
+//   53, 54
+// grub
+//   55, 56
+// player
+//   40, 41, 42 (with gun)
+//   45, 46
+// muzzle flash
+//   43
+// projectile
+//   44
+
+thread_local struct counters *sg_counters=nullptr;
+
+// Convenience macros
+#define Math_floor(VAL) (static_cast<int>(floor(VAL)))
+
+struct leveldata getleveldata(const struct gamestate & gs);
+
+#include "pathfinder.h"
+
+// Random number generator for gameplay
+float
+rng(struct gamestate & gs)
+{
+	return rng_float(gs.gamerng);
+}
+
+// Random number generator for cosmetic effects, so they don't perturb gameplay
+float
+fxrng(struct gamestate & gs)
+{
+	return rng_float(gs.fxrng);
+}
+
+// Check if input is pressed in the inputs latched for this update
+bool
+ispressed(const struct gamestate & gs, const platform_input input)
+{
+	return ((gs.input&(1<<input))!=0);
+}
+
+// Check if input went down during this frame's updates, for what runs once a frame (sequences and the host)
+bool
+waspressed(const struct gamestate & gs, const platform_input input)
+{
+	return ((gs.inputpressed&(1<<input))!=0);
+}
+
+// Latch inputs for the next update, from the platform or a replay, all game code reads these
+void
+latchinputs(struct gamestate & gs)
+{
+	uint32_t inputs=0;
+	bool played=false;
+
+	if (gs.replaymode==REPLAYPLAY)
+	{
+		played=replay_play(*gs.replay, inputs);
+
+		// Recording finished, hand back to the platform
+		if (!played)
+			gs.replaymode=REPLAYOFF;
+	}
+
+	if (!played)
+	{
+		inputs=platform_inputs();
+
+		if (gs.replaymode==REPLAYRECORD)
+			replay_record(*gs.replay, inputs);
+	}
+
+	// Edges come from the previous latch, so they replay and restore along with it
+	gs.inputpressed|=inputs&~gs.input;
+	gs.input=inputs;
+}
+
+void
+reset_gamestate(struct gamestate & gs)
+{
+	gs.gravity=0.25;
+	gs.terminalvelocity=10;
+	gs.friction=1;
+
+	gs.x=0;
+	gs.y=0;
+	gs.px=0;
+	gs.py=0;
+	gs.sx=0;
+	gs.sy=0;
+	gs.vs=0;
+	gs.hs=0;
+	gs.jump=false;
+	gs.fall=false;
+	gs.duck=false;
+	gs.htime=0;
+	gs.invtime=0;
+	gs.dir=0;
+	gs.hsp=1;
+	gs.vsp=1;
+	gs.speed=2;
+	gs.jumpspeed=5;
+	gs.coyote=0;
+	gs.life=100;
+	gs.flip=false;
+	gs.gun=false;
+	gs.shots.clear();
+	gs.gunheat=0;
+
+	gs.level=0;
+	gs.width=0;
+	gs.height=0;
+	gs.xoffset=0;
+	gs.yoffset=0;
+	gs.topdown=false;
+	gs.spawntime=SPAWNTIME;
+	gs.maxbees=MAXBEES;
+	gs.maxflies=MAXFLIES;
+	gs.aitick=0;
+	gs.aicursor=0;
+
+	gs.chars.clear();
+	gs.tick=0;
+
+	particles_clear(gs.particles);
+
+	gs.parallax.clear();
+
+	gs.msgboxtext.clear();
+	gs.msgboxtime=0;
+	gs.msgqueue.clear();
+
+	gs.input=0;
+	gs.inputpressed=0;
+
+	profile_reset(gs.prof, platform_clock);
+	counters_reset(gs.count);
+
+	rng_seed(gs.gamerng, gs.seed, 0);
+	rng_seed(gs.fxrng, gs.seed, 1);
+}
+
+void
+drawsprite(struct gamestate & gs, const uint8_t id, const real x, const real y, const bool flip)
+{
+	// Don't draw sprite 0 (background)
+	if (id==0) return;
+
+	// Clip to what's visible
+	if (((x-gs.xoffset)<-TILESIZE) || // clip left
+		((x-gs.xoffset)>XMAX) || // clip right
+		((y-gs.yoffset)<-TILESIZE) || // clip top
+		((y-gs.yoffset)>YMAX))   // clip bottom
+	return;
+
+	platform_image(Math_floor(x)-gs.xoffset, Math_floor(y)-gs.yoffset, id, flip);
+}
+
+// Scroll level to player
+void
+scrolltoplayer(struct gamestate & gs, const bool dampened)
+{
+	float xmiddle=Math_floor((XMAX-TILESIZE)/2);
+	float ymiddle=Math_floor((YMAX-TILESIZE)/2);
+	uint32_t maxxoffs=((gs.width*TILESIZE)-XMAX);
+	uint32_t maxyoffs=((gs.height*TILESIZE)-YMAX);
+
+	// Work out where x and y offsets should be
+	real newxoffs=gs.x-xmiddle;
+	real newyoffs=gs.y-ymiddle;
+
+	if (newxoffs>maxxoffs) newxoffs=maxxoffs;
+	if (newyoffs>maxyoffs) newyoffs=maxyoffs;
+
+	if (newxoffs<0) newxoffs=0;
+	if (newyoffs<0) newyoffs=0;
+
+	// Determine if xoffset should be changed
+	if (newxoffs!=gs.xoffset)
+	{
+		if (dampened)
+		{
+			uint32_t xdelta=1;
+
+			if (abs(gs.xoffset-newxoffs)>(XMAX/5)) xdelta=4;
+
+			gs.xoffset+=newxoffs>gs.xoffset?xdelta:-xdelta;
+		}
+		else
+			gs.xoffset=(int32_t)newxoffs;
+	}
+
+	// Determine if xoffset should be changed
+	if (newyoffs!=gs.yoffset)
+	{
+		if (dampened)
+		{
+			uint32_t ydelta=1;
+
+			if (abs(gs.yoffset-newyoffs)>(YMAX/5)) ydelta=4;
+
+			gs.yoffset+=newyoffs>gs.yoffset?ydelta:-ydelta;
+		}
+		else
+			gs.yoffset=(int32_t)newyoffs;
+	}
+}
+
+// Sort the chars so sprites are last (so they appear in front of non-solid tiles)
+bool
+sortChars(const struct gamechar & a, const struct gamechar & b)
+{
+	if (a.id!=b.id) // extra processing if they are different ids
+	{
+		bool aspr=(((a.id>=40) && (a.id<=46)) || ((a.id>=50) && (a.id<=56))); // see if a is a sprite
+		bool bspr=(((b.id>=40) && (b.id<=46)) || ((b.id>=50) && (b.id<=56))); // see if b is a sprite
+
+		if (aspr==bspr) return false; // both sprites
+
+		if (bspr)
+			return true; // sort a before b
+	}
+
+	return false; // same id
+}
+
+// Create a char of the given type, with its type specific attributes set
+struct gamechar
+makechar(struct gamestate & gs, const uint8_t id, const real x, const real y)
+{
+	struct gamechar obj;
+
+	obj.id=anim_charid(id);
+	obj.x=x;
+	obj.y=y;
+	obj.flip=false;
+	obj.hs=0;
+	obj.vs=0;
+	obj.dwell=0;
+	obj.htime=0;
+	obj.del=false;
+	obj.health=0;
+	obj.growtime=0;
+	obj.pollen=0;
+	obj.dx=-1;
+	obj.dy=-1;
+	obj.replans=0;
+	obj.phase=anim_phase(Math_floor(obj.x/TILESIZE), Math_floor(obj.y/TILESIZE));
+
+	switch (id)
+	{
+		case 30: // toadstool
+		case 31:
+		case 32: // flower
+		case 33:
+			obj.health=HEALTHPLANT;
+			obj.growtime=(GROWTIME+Math_floor(rng(gs)*120));
+			break;
+
+		case 53: // zombee
+		case 54:
+			obj.health=HEALTHZOMBEE;
+			obj.dwell=Math_floor(rng(gs)*FPS);
+			break;
+
+		case 51: // bee
+		case 52:
+			obj.dwell=Math_floor(rng(gs)*FPS);
+			break;
+
+		case 55: // grub
+		case 56:
+			obj.health=HEALTHGRUB;
+			obj.hs=(rng(gs)<0.5)?0.25:-0.25;
+			obj.flip=(obj.hs<0);
+			break;
+
+		default:
+			break;
+	}
+
+	return obj;
+}
+
+static_assert(leveldata_hash(levels, NUMLEVELS)==LEVELPREP_HASH, "levelprep.h is out of date with levels.h, rebuild levelprep");
+
+// Number of levels, the built in ones followed by any in the level pack
+uint8_t
+numlevels(const struct gamestate & gs)
+{
+	uint32_t count=NUMLEVELS+((gs.pack!=NULL)?gs.pack->count:0);
+
+	return (count<255)?count:255;
+}
+
+// Get a level, level pack ones follow on from the built in ones
+struct level
+getlevel(const struct gamestate & gs, const uint8_t level)
+{
+	if (level<NUMLEVELS)
+		return levels[level];
+
+	return levelpack_level(*gs.pack, level-NUMLEVELS);
+}
+
+// Load a layer of the current level into the tile map
+void
+unpacklayer(struct gamestate & gs, const uint8_t *layer, const uint32_t size, const bool packed)
+{
+	tilemap_load(gs.map, layer, size, packed, gs.width, gs.height);
+}
+
+// Keep the chunks around the view and the moving chars resident, on maps too big to hold whole
+void
+streammap(struct gamestate & gs)
+{
+	if (!tilemap_streams(gs.map))
+		return;
+
+	tilemap_want(gs.map, (gs.xoffset+(XMAX/2))/TILESIZE, (gs.yoffset+(YMAX/2))/TILESIZE, 1);
+	tilemap_want(gs.map, (int32_t)(gs.x/TILESIZE), (int32_t)(gs.y/TILESIZE), 1);
+
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+	{
+		switch (gs.chars[id].id)
+		{
+			case 51: // bee
+			case 52:
+			case 53: // zombee
+			case 54:
+			case 55: // grub
+			case 56:
+				tilemap_want(gs.map, (int32_t)(gs.chars[id].x/TILESIZE), (int32_t)(gs.chars[id].y/TILESIZE), 0);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	tilemap_stream(gs.map);
+}
+
+// Get derived data of current level, built in levels have theirs generated offline by levelprep
+struct leveldata
+getleveldata(const struct gamestate & gs)
+{
+	if (gs.level<NUMLEVELS)
+		return sg_leveldata[gs.level];
+
+	return {gs.spawnbuffer.data(), (uint32_t)gs.spawnbuffer.size(), gs.regionbuffer.data(), (uint32_t)gs.regionbuffer.size()};
+}
+
+// Get derived data ready for current level, working it out for level pack levels
+void
+prepareleveldata(struct gamestate & gs)
+{
+	if (gs.level>=NUMLEVELS)
+	{
+		std::vector<uint8_t> line(gs.width);
+		auto row=[&](const uint32_t y) { tilemap_row(gs.map, y, line.data()); return (const uint8_t *)line.data(); };
+
+		leveldata_spawns(row, gs.width, gs.height, gs.spawnbuffer);
+		leveldata_regions(row, gs.width, gs.height, gs.regionbuffer);
+	}
+	else
+	{
+		gs.spawnbuffer.clear();
+		gs.regionbuffer.clear();
+	}
+
+	const struct leveldata ld=getleveldata(gs);
+
+	tilemap_load(gs.regions, ld.regions, ld.regionssize, true, gs.width, gs.height);
+	gs.spawnfree.reserve(ld.numspawns);
+}
+
+// Add stress test populations to the level being loaded
+void
+stresspopulate(struct gamestate & gs)
+{
+	struct stressconfig cfg=gs.stress;
+
+	// Allow stress testing to be selected on the cabinet
+	if ((ispressed(gs, INPUT_DIPSW1)) && (ispressed(gs, INPUT_PLAYER1_UP)))
+	{
+		if (cfg.bees==0) cfg.bees=STRESSBEES;
+		if (cfg.zombees==0) cfg.zombees=STRESSZOMBEES;
+		if (cfg.grubs==0) cfg.grubs=STRESSGRUBS;
+		if (cfg.plants==0) cfg.plants=STRESSPLANTS;
+	}
+
+	bool stressed=((cfg.bees+cfg.zombees+cfg.grubs+cfg.plants)>0);
+
+	// Lift the population caps, so stress populations can breed freely
+	gs.maxbees=stressed?UINT32_MAX:MAXBEES;
+	gs.maxflies=stressed?UINT32_MAX:MAXFLIES;
+
+	if (!stressed) return;
+
+	// Count empty tiles for flying chars by row, everything else goes on the spawn points
+	std::vector<uint32_t> airrows(gs.height+1, 0); // Empty tiles in the rows before each row
+	std::vector<uint8_t> line(gs.width);
+
+	for (uint32_t y=0; y<gs.height; y++)
+	{
+		tilemap_row(gs.map, y, line.data());
+		airrows[y+1]=airrows[y]+std::count_if(line.begin(), line.end(), [](const uint8_t tile) { return (tile<=1); });
+	}
+
+	const uint32_t air=airrows[gs.height];
+	const struct leveldata ld=getleveldata(gs);
+
+	if ((air==0) || (ld.numspawns==0)) return;
+
+	// Pick an empty tile, as the nth of them all row by row
+	auto pickair=[&]()
+	{
+		uint32_t n=Math_floor(rng(gs)*air);
+		uint32_t y=(std::upper_bound(airrows.begin(), airrows.end(), n)-airrows.begin())-1;
+		uint32_t x=0;
+
+		n-=airrows[y];
+		tilemap_row(gs.map, y, line.data());
+
+		for (; x<gs.width; x++)
+			if ((line[x]<=1) && (n--==0))
+				break;
+
+		return (struct spawnpoint){(float)x, (float)y};
+	};
+
+	gs.chars.reserve(gs.chars.size()+cfg.bees+cfg.zombees+cfg.grubs+cfg.plants);
+
+	for (uint32_t i=0; i<cfg.bees; i++)
+	{
+		const struct spawnpoint sp=pickair();
+		gs.chars.push_back(makechar(gs, 51, sp.x*TILESIZE, sp.y*TILESIZE));
+	}
+
+	for (uint32_t i=0; i<cfg.zombees; i++)
+	{
+		const struct spawnpoint sp=pickair();
+		gs.chars.push_back(makechar(gs, 53, sp.x*TILESIZE, sp.y*TILESIZE));
+	}
+
+	for (uint32_t i=0; i<cfg.grubs; i++)
+	{
+		const struct spawnpoint & sp=ld.spawns[Math_floor(rng(gs)*ld.numspawns)];
+		gs.chars.push_back(makechar(gs, 55, sp.x*TILESIZE, sp.y*TILESIZE));
+	}
+
+	for (uint32_t i=0; i<cfg.plants; i++)
+	{
+		const struct spawnpoint & sp=ld.spawns[Math_floor(rng(gs)*ld.numspawns)];
+		gs.chars.push_back(makechar(gs, (rng(gs)<0.6)?33:31, sp.x*TILESIZE, sp.y*TILESIZE));
+	}
+}
+
+// Load level
+void
+loadlevel(struct gamestate & gs)
+{
+	TRACE_SCOPE_ARG(gs, "loadlevel", "chars");
+
+	// Make sure it exists
+	if (gs.level>=numlevels(gs)) return;
+
+	const struct level lvl=getlevel(gs, gs.level);
+
+	// Get width/height of new level
+	gs.width=lvl.width;
+	gs.height=lvl.height;
+
+	gs.chars.clear();
+
+	// Populate chars (non solid tiles), using the working buffer before it holds the tiles
+	unpacklayer(gs, lvl.chars, lvl.charssize, lvl.packed);
+
+	std::vector<uint8_t> line(gs.width);
+
+	for (int y=0;y<gs.height;y++)
+	{
+		tilemap_row(gs.map, y, line.data());
+
+		for (int x=0;x<gs.width;x++)
+		{
+			uint8_t tile=line[x];
+			if (tile!=0)
+			{
+				struct gamechar obj=makechar(gs, tile-1, x*TILESIZE, y*TILESIZE);
+
+				switch (tile-1)
+				{
+					case 40: // Player
+					case 41:
+					case 42:
+					case 45:
+					case 46:
+						gs.x=obj.x; // Set current position
+						gs.y=obj.y;
+
+						gs.sx=obj.x; // Set start position
+						gs.sy=obj.y;
+
+						gs.vs=0; // Start not moving
+						gs.hs=0;
+						gs.jump=false;
+						gs.fall=false;
+						gs.dir=0;
+						gs.flip=false;
+						gs.gun=false;
+						gs.shots.clear();
+						gs.gunheat=0;
+						particles_clear(gs.particles);
+						gs.topdown=false;
+						gs.spawntime=SPAWNTIME;
+						break;
+
+					default:
+						gs.chars.push_back(obj); // Everything else
+						break;
+				}
+			}
+		}
+	}
+
+	unpacklayer(gs, lvl.tiles, lvl.tilessize, lvl.packed);
+	prepareleveldata(gs);
+	stresspopulate(gs);
+
+	// Sort chars such sprites are at the end (so are drawn last, i.e on top)
+	std::sort(gs.chars.begin(), gs.chars.end(), sortChars);
+
+	// Populate parallax field
+	gs.parallax.clear();
+	for (int i=0; i<4; i++)
+		for (int z=1; z<=2; z++)
+		{
+			struct parallax p;
+
+			p.t=Math_floor(fxrng(gs)*3);
+			p.x=Math_floor((fxrng(gs)*gs.width)*TILESIZE);
+			p.y=Math_floor((fxrng(gs)*(gs.height/2))*TILESIZE);
+			p.z=z*10;
+
+			gs.parallax.push_back(p);
+		}
+
+	// Move scroll offset to player with damping disabled
+	scrolltoplayer(gs, false);
+
+	TRACE_ARG(gs.chars.size());
+}
+
+void
+write(const float x, const float y, const std::string & text, const uint8_t size, const uint8_t r, const uint8_t g, const uint8_t b, const float a)
+{
+	platform_set_colour(r, g, b, (a*255));
+
+	for (uint8_t i=0; i<text.length(); i++)
+	{
+		int16_t offs=(text[i]-32);
+
+		// Don't try to draw characters outside our font set
+		if ((offs<0) || (offs>94))
+			continue;
+
+		// Draw "pixels"
+		uint16_t px=0;
+		uint16_t py=0;
+
+		// Iterate through the 4 bytes (columns) used to define character
+		for (uint8_t j=0; j<font_width; j++)
+		{
+			uint8_t dual=font_8bit[(offs*font_width)+j];
+
+			// Iterate through bits in byte
+			for (uint8_t k=0; k<font_height; k++)
+			{
+				if (dual&(1<<(font_height-k)))
+					platform_solid_rectangle(Math_floor(x+(i*font_width*size)+(px*size)), Math_floor(y+(size*py)), size, size);
+
+				px++;
+				if (px==font_width)
+				{
+					px=0;
+					py++;
+				}
+			}
+		}
+	}
+}
+
+// Draw level
+void
+drawlevel(struct gamestate & gs)
+{
+	// Only visit the tiles in view, drawsprite() does the exact clipping
+	int32_t x1=std::max((gs.xoffset/TILESIZE)-1, 0);
+	int32_t y1=std::max((gs.yoffset/TILESIZE)-1, 0);
+	int32_t x2=std::min(((gs.xoffset+XMAX)/TILESIZE)+1, gs.width-1);
+	int32_t y2=std::min(((gs.yoffset+YMAX)/TILESIZE)+1, gs.height-1);
+
+	for (int y=y1;y<=y2;y++)
+		for (int x=x1;x<=x2;x++)
+		{
+			uint8_t tile=tilemap_get(gs.map, x, y);
+			if (tile>0)
+				drawsprite(gs, tile-1, x*TILESIZE, y*TILESIZE, false);
+		}
+
+	// Draw level number
+	write(10, 10, std::string("Level ")+std::to_string(gs.level+1), 1, 0, 0, 0, 1);
+}
+
+// Player tile to draw, walking when moving otherwise standing on the clip's first frame
+uint8_t
+playerframe(const struct gamestate & gs)
+{
+	uint8_t clip=(gs.gun)?ANIMGUNWALK:ANIMWALK;
+
+	if ((gs.hs!=0) || ((gs.topdown) && (gs.vs!=0)))
+		return anim_frame(clip, gs.tick, 0);
+
+	return sg_animclips[clip].first;
+}
+
+// Draw chars
+void
+drawchars(struct gamestate & gs)
+{
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+	{
+		drawsprite(gs, anim_charframe(gs.chars[id].id, gs.tick, gs.chars[id].phase), gs.chars[id].x, gs.chars[id].y, gs.chars[id].flip);
+
+		// Draw health bar
+		if (((gs.chars[id].health)>0) && ((gs.chars[id].htime)>0))
+		{
+			float hmax=0;
+
+			switch (gs.chars[id].id)
+			{
+				case 30:
+				case 31:
+					hmax=HEALTHPLANT;
+					break;
+
+				case 53:
+				case 54:
+					hmax=HEALTHZOMBEE;
+					break;
+
+				case 55:
+				case 56:
+					hmax=HEALTHGRUB;
+					break;
+
+				default:
+					break;
+			}
+
+			if (hmax>0)
+			{
+				platform_set_colour(0, 255, 0, (0.75*255));
+				platform_solid_rectangle(Math_floor(gs.chars[id].x)-gs.xoffset, Math_floor(gs.chars[id].y)-gs.yoffset, Math_floor(TILESIZE*(gs.chars[id].health/hmax))+1, 2);
+			}
+		}
+
+		if ((ispressed(gs, INPUT_DIPSW1)) && (!governor_sheds(gs.gov, SHEDDEBUG)))
+		{
+			// Draw health above it
+			if (gs.chars[id].health!=0)
+				write(Math_floor(gs.chars[id].x)-gs.xoffset, (Math_floor(gs.chars[id].y)-gs.yoffset)-8, std::to_string(gs.chars[id].health), 1, 0,0,0, 1);
+
+			// Draw pollen above it
+			if (gs.chars[id].pollen!=0)
+				write(Math_floor(gs.chars[id].x)-gs.xoffset+(TILESIZE*0.75), (Math_floor(gs.chars[id].y)-gs.yoffset)-8, std::to_string(gs.chars[id].pollen), 1, 255,0,255, 1);
+
+			// Draw dwell below it
+			if (gs.chars[id].dwell!=0)
+				write(Math_floor(gs.chars[id].x)-gs.xoffset+(TILESIZE*0.75), (Math_floor(gs.chars[id].y)-gs.yoffset)+TILESIZE, std::to_string(gs.chars[id].dwell), 1, 0,255,0, 1);
+		}
+	}
+}
+
+// Draw shots
+void
+drawshots(struct gamestate & gs)
+{
+	for (uint32_t i=0; i<gs.shots.size(); i++)
+	{
+		if (gs.shots[i].ttl>=35)
+			gs.shots[i].id=43; // muzzle flash sprite
+		else
+			gs.shots[i].id=44; // projectile sprite
+
+		drawsprite(gs, gs.shots[i].id, gs.shots[i].x, gs.shots[i].y, gs.shots[i].flip); // normal
+	}
+}
+
+// Draw particles
+void
+drawparticles(struct gamestate & gs)
+{
+	const struct particlepool & p=gs.particles;
+
+	for (uint32_t i=0; i<p.count; i++)
+	{
+		int32_t x=Math_floor(p.x[i]+(p.t[i]*p.dx[i]))-gs.xoffset;
+		int32_t y=Math_floor(p.y[i]+(p.t[i]*p.dy[i]))-gs.yoffset;
+
+		// Clip to what's visible
+		if ((x<-p.s[i]) || (x>XMAX) || (y<-p.s[i]) || (y>YMAX))
+			continue;
+
+		platform_set_colour(p.r[i], p.g[i], p.b[i], (int32_t)(p.a[i]*255));
+		platform_solid_rectangle(x, y, p.s[i], p.s[i]);
+	}
+}
+
+// Draw parallax
+void
+drawparallax(struct gamestate & gs)
+{
+	for (uint32_t i=0; i<gs.parallax.size(); i++)
+	{
+		switch (gs.parallax[i].t)
+		{
+			case 0:
+			case 1:
+				drawsprite(gs, 11+gs.parallax[i].t, gs.parallax[i].x-Math_floor(gs.xoffset/gs.parallax[i].z), gs.parallax[i].y-Math_floor(gs.yoffset/gs.parallax[i].z), false);
+				break;
+
+			case 2:
+				drawsprite(gs, 1, gs.parallax[i].x-Math_floor(gs.xoffset/gs.parallax[i].z), gs.parallax[i].y-Math_floor(gs.yoffset/gs.parallax[i].z), false);
+				drawsprite(gs, 2, gs.parallax[i].x-Math_floor(gs.xoffset/gs.parallax[i].z)+TILESIZE, gs.parallax[i].y-Math_floor(gs.yoffset/gs.parallax[i].z), false);
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+// Show messsage box
+void
+showmessagebox(struct gamestate & gs, const std::string & text, const uint32_t timing)
+{
+	if ((gs.msgboxtime==0) && (gs.state==STATEPLAYING))
+	{
+		// Set text to display
+		gs.msgboxtext=text;
+
+		// Set time to display messagebox
+		gs.msgboxtime=timing;
+	}
+	else
+	{
+		struct msgboxitem m;
+
+		m.msgboxtext=text;
+		m.msgboxtime=timing;
+
+		gs.msgqueue.push_back(m);
+	}
+}
+
+std::vector<std::string>
+strsplit(const std::string & str, const std::string & delimiter)
+{
+	std::vector<std::string> ostr;
+	size_t pos=0;
+	std::string token;
+	std::string s=str;
+
+	while ((pos=s.find(delimiter))!=std::string::npos)
+	{
+		token=s.substr(0, pos);
+		ostr.push_back(token);
+		s=s.substr(pos + delimiter.length());
+	}
+
+	if (s.length()>0)
+		ostr.push_back(s);
+
+	return ostr;
+}
+
+void
+drawmsgbox(struct gamestate & gs)
+{
+	if (gs.msgboxtime>0)
+	{
+		uint8_t i;
+		uint16_t width=0;
+		uint16_t height=0;
+		float top=0;
+		int8_t icon=-1;
+		uint16_t boxborder=1;
+
+		// Draw box //
+		// Split on \n
+		std::vector<std::string> txtlines = strsplit(gs.msgboxtext, "\n");
+
+		// Determine width (length of longest string + border)
+		for (i=0; i<txtlines.size(); i++)
+		{
+			// Check for and remove icon from first line
+			if ((i==0) && (txtlines[i][0]=='['))
+			{
+				size_t endbracket=txtlines[i].find(']');
+				if (endbracket!=std::string::npos)
+				{
+					icon=std::stoi(txtlines[i].substr(1, endbracket), nullptr, 10);
+					txtlines[i]=txtlines[i].substr(endbracket+1, std::string::npos);
+				}
+			}
+
+			if (txtlines[i].length()>width)
+				width=txtlines[i].length();
+		}
+
+		width+=(boxborder*2);
+
+		// Determine height (number of lines + border)
+		height=txtlines.size()+(boxborder*2);
+
+		// Convert width/height into pixels
+		width*=font_width;
+		height*=(font_height+1);
+
+		// Add space if sprite is to be drawn
+		if (icon!=-1)
+		{
+			// Check for centering text when only one line and icon pads height
+			if (txtlines.size()==1)
+				top=0.5;
+    
+			width+=(TILESIZE+(font_width*2));
+
+			if (height<(TILESIZE+(2*font_height)))
+				height=TILESIZE+(2*font_height);
+		}
+
+		// Roll-up
+		if (gs.msgboxtime<8)
+			height=Math_floor(height*(gs.msgboxtime/8));
+
+		// Draw box
+		platform_set_colour(255, 255, 255, (0.75*255));
+		platform_solid_rectangle(XMAX-(width+(boxborder*font_width)), 1*font_height, width, height);
+
+		if (gs.msgboxtime>=8)
+		{
+			// Draw optional sprite
+			if (icon!=-1)
+				drawsprite(gs, icon, (XMAX-width)+gs.xoffset, ((boxborder*2)*font_height)+gs.yoffset, false);
+
+			// Draw text //
+			for (i=0; i<txtlines.size(); i++)
+				write(XMAX-width+(icon==-1?0:TILESIZE+font_width), (i+(boxborder*2)+top)*(font_height+1), txtlines[i], 1, 0, 0, 0, 0.75);
+		}
+
+		gs.msgboxtime--;
+	}
+	else
+	{
+		// Check if there are any message boxes queued up
+		if ((gs.state==STATEPLAYING) && (gs.msgqueue.size()>0))
+		{
+			showmessagebox(gs, gs.msgqueue[0].msgboxtext, gs.msgqueue[0].msgboxtime);
+			gs.msgqueue.erase(gs.msgqueue.begin());
+		}
+	}
+}
+
+// Generate some particles around an origin
+void
+generateparticles(struct gamestate & gs, const real cx, const real cy, const real mt, const uint8_t count, const uint8_t r, const uint8_t g, const uint8_t b)
+{
+	struct particlepool & p=gs.particles;
+	uint8_t emit=count;
+
+	// Make do with a quarter of them while frames are running over
+	if (governor_sheds(gs.gov, SHEDPARTICLES))
+		emit=(count+3)/4;
+
+	for (uint8_t i=0; i<emit; i++)
+	{
+		int32_t n=particles_add(p);
+
+		if (n<0)
+			return; // pool full, drop the rest
+
+		uint32_t deg=Math_floor(fxrng(gs)*PARTICLEDIRS); // angle to emanate from, in whole degrees
+
+		p.dx[n]=sg_particledirs.dx[deg]; // direction set once here, so moving is just travel along it
+		p.dy[n]=sg_particledirs.dy[deg];
+		p.t[n]=Math_floor(fxrng(gs)*mt); // travel from centre
+		p.r[n]=(r==0?fxrng(gs)*255:r);
+		p.g[n]=(g==0?fxrng(gs)*255:g);
+		p.b[n]=(b==0?fxrng(gs)*255:b);
+		p.a[n]=1;
+
+		p.x[n]=cx;
+		p.y[n]=cy;
+
+		p.s[n]=(fxrng(gs)<0.25)?2:1;
+	}
+}
+
+// Check if area a overlaps with area b
+bool
+overlap(const real ax, const real ay, const real aw, const real ah, const real bx, const real by, const real bw, const real bh)
+{
+	counter_add(COUNTER_OVERLAP);
+
+	// Check horizontally
+	if ((ax<bx) && ((ax+aw))<=bx) return false; // a too far left of b
+	if ((ax>bx) && ((bx+bw))<=ax) return false; // a too far right of b
+
+	// Check vertically
+	if ((ay<by) && ((ay+ah))<=by) return false; // a too far above b
+	if ((ay>by) && ((by+bh))<=ay) return false; // a too far below b
+
+	return true;
+}
+
+// Do processing for gun
+void
+guncheck(struct gamestate & gs)
+{
+	uint32_t i;
+
+	// Cool gun down
+	if (gs.gunheat>0) gs.gunheat--;
+
+	// Check for having gun and want to use it
+	if ((gs.gun==true) && (gs.gunheat==0) && (ispressed(gs, INPUT_PLAYER1_BUTTON1)))
+	{
+		int16_t velocity=(gs.flip?-5:5);
+		struct shot oneshot;
+
+		oneshot.x=gs.x+velocity;
+		oneshot.y=gs.y+3;
+		oneshot.dir=velocity;
+		oneshot.flip=gs.flip;
+		oneshot.ttl=40;
+		oneshot.id=44; // Gun shot sprite
+		oneshot.del=false;
+
+		gs.shots.push_back(oneshot);
+
+		gs.gunheat=10; // Set time until next shot
+	}
+
+	// Move shots onwards / check for collisions
+	for (i=0; i<gs.shots.size(); i++)
+	{
+		// Move shot onwards
+		gs.shots[i].x+=gs.shots[i].dir;
+
+		// Check shot collisions
+		for (uint32_t id=0; id<gs.chars.size(); id++)
+		{
+			// Check for collision with this char
+			if ((gs.shots[i].dir!=0) && (overlap(gs.shots[i].x, gs.shots[i].y, TILESIZE, TILESIZE, gs.chars[id].x, gs.chars[id].y, TILESIZE, TILESIZE)))
+			{
+				switch (gs.chars[id].id)
+				{
+					case 30: // toadstool
+					case 31:
+						gs.chars[id].htime=(2*FPS);
+						gs.chars[id].health--;
+						if (gs.chars[id].health<=0)
+						{
+							if (gs.chars[id].id==30) // If it's tall, change to small toadstool
+							{
+								gs.chars[id].health=HEALTHPLANT;
+								gs.chars[id].growtime=(GROWTIME+Math_floor(rng(gs)*120));
+								gs.chars[id].id=31;
+							}
+							else
+								gs.chars[id].del=true;
+						}
+
+						generateparticles(gs, gs.chars[id].x+(TILESIZE/2), gs.chars[id].y+(TILESIZE/2), 8, (gs.chars[id].health<=0)?16:2, 252, 104, 59);
+
+						gs.shots[i].dir=0;
+						gs.shots[i].ttl=3;
+						break;
+
+					case 53: // zombee
+					case 54:
+						gs.chars[id].htime=(2*FPS);
+						gs.chars[id].health--;
+						if (gs.chars[id].health<=0)
+							gs.chars[id].del=true;
+
+						generateparticles(gs, gs.chars[id].x+(TILESIZE/2), gs.chars[id].y+(TILESIZE/2), 16, (gs.chars[id].health<=0)?32:4, 44, 197, 246);
+
+						gs.shots[i].dir=0;
+						gs.shots[i].ttl=3;
+						break;
+
+					case 55: // grub
+					case 56:
+						gs.chars[id].htime=(2*FPS);
+						gs.chars[id].health--;
+						if (gs.chars[id].health<=0)
+							gs.chars[id].del=true;
+
+						generateparticles(gs, gs.chars[id].x+(TILESIZE/2), gs.chars[id].y+(TILESIZE/2), 16, (gs.chars[id].health<=0)?32:4, 252, 104, 59);
+
+						gs.shots[i].dir=0;
+						gs.shots[i].ttl=3;
+						break;
+
+					default:
+						break;
+				}
+			}
+		}
+
+		// Decrease time-to-live, mark for deletion when expired
+		gs.shots[i].ttl--;
+		if (gs.shots[i].ttl<=0) gs.shots[i].del=true;
+	}
+
+	// Remove shots marked for deletion
+	i=gs.shots.size();
+	while (i--)
+	{
+		if (gs.shots[i].del)
+		{
+			gs.shots.erase(gs.shots.begin()+i);
+			counter_add(COUNTER_ERASED);
+		}
+	}
+}
+
+// Check if player has left the map
+void
+offmapcheck(struct gamestate & gs)
+{
+	if ((gs.x<(0-TILESIZE)) || ((gs.x+1)>gs.width*TILESIZE) || (gs.y>gs.height*TILESIZE))
+	{
+		gs.x=gs.sx;
+		gs.y=gs.sy;
+
+		scrolltoplayer(gs, false);
+	}
+}
+
+bool
+collide(const struct gamestate & gs, const real px, const real py, const real pw, const real ph)
+{
+	counter_add(COUNTER_COLLIDE);
+
+	// Check for screen edge collision
+	if (px<=(0-(TILESIZE/5))) return true;
+	if ((px+(TILESIZE/3))>=(gs.width*TILESIZE)) return true;
+
+	// Look through the tiles around the box for a collision, one more each side for edges
+	int32_t x1=std::max(Math_floor(px/TILESIZE)-1, 0);
+	int32_t y1=std::max(Math_floor(py/TILESIZE)-1, 0);
+	int32_t x2=std::min(Math_floor((px+pw)/TILESIZE)+1, gs.width-1);
+	int32_t y2=std::min(Math_floor((py+ph)/TILESIZE)+1, gs.height-1);
+
+	for (int32_t y=y1; y<=y2; y++)
+	{
+		for (int32_t x=x1; x<=x2; x++)
+		{
+			uint8_t tile=tilemap_get(gs.map, x, y);
+			if (tile>1)
+			{
+				if (overlap(px, py, pw, ph, x*TILESIZE, y*TILESIZE, TILESIZE, TILESIZE))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+// Collision check with player hitbox
+bool
+playercollide(const struct gamestate & gs, const real x, const real y)
+{
+	return collide(gs, x+(TILESIZE/3), y+((TILESIZE/5)*2), TILESIZE/3, (TILESIZE/5)*3);
+}
+
+// Check if player on the ground or falling
+void
+groundcheck(struct gamestate & gs)
+{
+	// Check for coyote time
+	if (gs.coyote>0)
+		gs.coyote--;
+
+	// Check we are on the ground
+	if (playercollide(gs, gs.x, gs.y+1))
+	{
+		// If we just hit the ground after falling, create a few particles under foot
+		if (gs.fall==true)
+			generateparticles(gs, gs.x+(TILESIZE/2), gs.y+TILESIZE, 4, 4, 170, 170, 170);
+
+		gs.vs=0;
+		gs.jump=false;
+		gs.fall=false;
+		gs.coyote=15;
+
+		// Check for jump pressed, when not ducking
+		if ((ispressed(gs, INPUT_PLAYER1_UP)) && (!gs.duck))
+		{
+			gs.jump=true;
+			gs.vs=-gs.jumpspeed;
+		}
+	}
+	else
+	{
+		// Check for jump pressed, when not ducking, and coyote time not expired
+		if ((ispressed(gs, INPUT_PLAYER1_UP)) && (!gs.duck) && (gs.jump==false) && (gs.coyote>0))
+		{
+			gs.jump=true;
+			gs.vs=-gs.jumpspeed;
+		}
+
+		// We're in the air, increase falling speed until we're at terminal velocity
+		if (gs.vs<gs.terminalvelocity)
+			gs.vs+=gs.gravity;
+
+		// Set falling flag when vertical speed is positive
+		if (gs.vs>0)
+			gs.fall=true;
+	}
+}
+
+// Process jumping
+void
+jumpcheck(struct gamestate & gs)
+{
+	// When jumping ..
+	if (gs.jump)
+	{
+		// Check if loosing altitude
+		if (gs.vs>=0)
+		{
+			gs.jump=false;
+			gs.fall=true;
+		}
+	}
+}
+
+// Move player by appropriate amount, up to a collision
+void
+collisioncheck(struct gamestate & gs)
+{
+  uint8_t loop;
+
+  // Check for horizontal collisions
+  if ((gs.hs!=0) && (playercollide(gs, gs.x+gs.hs, gs.y)))
+  {
+    loop=TILESIZE;
+    // A collision occured, so move the character until it hits
+    while ((!playercollide(gs, gs.x+(gs.hs>0?1:-1), gs.y)) && (loop>0))
+    {
+      gs.x+=(gs.hs>0?1:-1);
+      loop--;
+    }
+
+    // Stop horizontal movement
+    gs.hs=0;
+  }
+  gs.x+=Math_floor(gs.hs);
+
+  // Check for vertical collisions
+  if ((gs.vs!=0) && (playercollide(gs, gs.x, gs.y+gs.vs)))
+  {
+    loop=TILESIZE;
+    // A collision occured, so move the character until it hits
+    while ((!playercollide(gs, gs.x, gs.y+(gs.vs>0?1:-1))) && (loop>0))
+    {
+      gs.y+=(gs.vs>0?1:-1);
+      loop--;
+    }
+
+    // Stop vertical movement
+    gs.vs=0;
+  }
+  gs.y+=Math_floor(gs.vs);
+}
+
+// If no input detected, slow the player using friction
+void
+standcheck(struct gamestate & gs)
+{
+  // Check for ducking, or injured
+  if ((ispressed(gs, INPUT_PLAYER1_DOWN)) || (gs.htime>0))
+    gs.duck=true;
+  else
+    gs.duck=false;
+
+  // When no horizontal movement pressed, slow down by friction
+  if (((!ispressed(gs, INPUT_PLAYER1_LEFT)) && (!ispressed(gs, INPUT_PLAYER1_RIGHT))) ||
+      ((ispressed(gs, INPUT_PLAYER1_LEFT)) && (ispressed(gs, INPUT_PLAYER1_RIGHT))))
+  {
+    // Going left
+    if (gs.dir==-1)
+    {
+      if (gs.hs<0)
+      {
+        gs.hs+=gs.friction;
+      }
+      else
+      {
+        gs.hs=0;
+        gs.dir=0;
+      }
+    }
+
+    // Going right
+    if (gs.dir==1)
+    {
+      if (gs.hs>0)
+      {
+        gs.hs-=gs.friction;
+      }
+      else
+      {
+        gs.hs=0;
+        gs.dir=0;
+      }
+    }
+  }
+
+  // Extra checks for top-down levels
+  if (gs.topdown)
+  {
+    // When no horizontal movement pressed, slow down by friction
+    if (((!ispressed(gs, INPUT_PLAYER1_UP)) && (!ispressed(gs, INPUT_PLAYER1_DOWN))) ||
+    ((ispressed(gs, INPUT_PLAYER1_UP)) && (ispressed(gs, INPUT_PLAYER1_DOWN))))
+    {
+      // Going up
+      if (gs.vs<0)
+      {
+        gs.vs+=gs.friction;
+      }
+
+      // Going down
+      if (gs.vs>0)
+      {
+        gs.vs-=gs.friction;
+      }
+    }
+  }
+}
+
+// Do processing for particles
+void
+particlecheck(struct gamestate & gs)
+{
+	// Move particles onwards, falling and decaying as they go
+	particles_update(gs.particles, 0.5, (gs.gravity*2), 0.007);
+
+	// Remove particles which have decayed
+	counter_add(COUNTER_ERASED, particles_compact(gs.particles));
+}
+
+bool
+anymovementkeypressed(const struct gamestate & gs)
+{
+	return (
+		ispressed(gs, INPUT_PLAYER1_UP) ||
+		ispressed(gs, INPUT_PLAYER1_DOWN) ||
+		ispressed(gs, INPUT_PLAYER1_LEFT) ||
+		ispressed(gs, INPUT_PLAYER1_RIGHT) 
+	);
+}
+
+// Check if any movement key went down this update, so a key still held from before doesn't count
+bool
+anymovementkeywaspressed(const struct gamestate & gs)
+{
+	return (
+		waspressed(gs, INPUT_PLAYER1_UP) ||
+		waspressed(gs, INPUT_PLAYER1_DOWN) ||
+		waspressed(gs, INPUT_PLAYER1_LEFT) ||
+		waspressed(gs, INPUT_PLAYER1_RIGHT)
+	);
+}
+
+// Update player movements
+void
+updatemovements(struct gamestate & gs)
+{
+	// Check if player has left the map
+	offmapcheck(gs);
+
+	// Only apply 2D physics when not in top-down mode
+	if (!gs.topdown)
+	{
+		// Check if player on the ground or falling
+		groundcheck(gs);
+
+		// Process jumping
+		jumpcheck(gs);
+	}
+
+	// Move player by appropriate amount, up to a collision
+	collisioncheck(gs);
+
+	// If no input detected, slow the player using friction
+	standcheck(gs);
+
+	// Check for gun usage
+	guncheck(gs);
+
+	// Check for particle usage
+	particlecheck(gs);
+
+	// When a movement key is pressed, adjust players speed and direction
+	if (anymovementkeypressed(gs))
+	{
+		// Left key
+		if ((ispressed(gs, INPUT_PLAYER1_LEFT)) && (!ispressed(gs, INPUT_PLAYER1_RIGHT)))
+		{
+			gs.hs=gs.htime==0?-gs.speed:-1;
+			gs.dir=-1;
+			gs.flip=true;
+		}
+
+		// Right key
+		if ((ispressed(gs, INPUT_PLAYER1_RIGHT)) && (!ispressed(gs, INPUT_PLAYER1_LEFT)))
+		{
+			gs.hs=gs.htime==0?gs.speed:1;
+			gs.dir=1;
+			gs.flip=false;
+		}
+
+		// Extra processing for top-down levels
+		if (gs.topdown)
+		{
+			// Up key
+			if ((ispressed(gs, INPUT_PLAYER1_UP)) && (!ispressed(gs, INPUT_PLAYER1_DOWN)))
+			{
+				gs.vs=gs.htime==0?-gs.speed:-1;
+			}
+
+			// Down key
+			if ((ispressed(gs, INPUT_PLAYER1_DOWN)) && (!ispressed(gs, INPUT_PLAYER1_UP)))
+			{
+				gs.vs=gs.htime==0?gs.speed:1;
+			}
+		}
+	}
+
+	// Decrease hurt timer
+	if (gs.htime>0) gs.htime--;
+
+	// Decrease invulnerability timer
+	if (gs.invtime>0) gs.invtime--;
+}
+
+// Check for collision between player and character/collectable
+void
+updateplayerchar(struct gamestate & gs)
+{
+	// Generate player hitbox
+	real px=gs.x+(TILESIZE/3);
+	real py=gs.y+((TILESIZE/5)*2);
+	float pw=(TILESIZE/3);
+	float ph=(TILESIZE/5)*3;
+
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+	{
+		// Check for collision with this char
+		if (overlap(px, py, pw, ph, gs.chars[id].x, gs.chars[id].y, TILESIZE, TILESIZE))
+		{
+			switch (gs.chars[id].id)
+			{
+				case 0: // flip between 2D and topdown
+					gs.topdown=(
+						(gs.chars[id].y>=TILESIZE) && (tilemap_get(gs.map, Math_floor(gs.chars[id].x/TILESIZE), Math_floor((gs.chars[id].y-TILESIZE)/TILESIZE))<=1) && // Tile above this toggle needs to be empty
+						(gs.vs<0)); // pass over moving up for topdown, otherwise 2D
+					break;
+
+				case 10: // JS13K - invulnerability
+					gs.htime=0; // cure player
+					gs.invtime+=(10*FPS);
+					gs.chars[id].del=true;
+					break;
+
+				case 53: // Zombee
+				case 54:
+					if ((gs.invtime==0) && (gs.htime==0))
+						gs.htime=(5*FPS); // Set hurt timer
+
+					if (gs.gun)
+					{
+						// Drop gun
+						struct gamechar obj;
+
+						obj.id=50;
+						obj.x=gs.x;
+						obj.y=gs.y;
+						obj.flip=false;
+						obj.hs=0;
+						obj.vs=0;
+						obj.dwell=0;
+						obj.htime=0;
+						obj.del=false;
+						obj.health=0;
+
+						obj.growtime=0;
+						obj.pollen=0;
+						obj.dx=-1;
+						obj.dy=-1;
+						obj.replans=0;
+						obj.phase=anim_phase(Math_floor(obj.x/TILESIZE), Math_floor(obj.y/TILESIZE));
+
+						gs.chars.push_back(obj);
+
+						gs.gun=false;
+					}
+					break;
+
+				case 55: // Grub
+				case 56:
+					if ((gs.invtime==0) && (gs.htime==0))
+						gs.htime=(2*FPS); // Set hurt timer
+					break;
+
+				case 50: // gun
+					if ((gs.invtime>0) || (gs.htime==0))
+					{
+						gs.gun=true;
+						gs.chars[id].del=true;
+					}
+					break;
+
+				default:
+					break;
+			}
+		}
+	}
+}
+
+// Determine distance (Hypotenuse) between two lengths in 2D space (using Pythagoras)
+real
+calcHypotenuse(const real a, const real b)
+{
+	return fixed_hypot(a, b);
+}
+
+// Find the nearst char of type included in tileids to given x, y point or -1
+int32_t
+findnearestchar(const struct gamestate & gs, const real x, const real y, const std::vector<uint16_t> & tileids)
+{
+  counter_add(COUNTER_FINDNEAREST);
+
+  real closest=0;
+  int32_t charid=-1;
+  real dist;
+
+  for (uint32_t id=0; id<gs.chars.size(); id++)
+  {
+    if (std::count(tileids.begin(), tileids.end(), gs.chars[id].id)>0)
+    {
+      dist=calcHypotenuse(x-gs.chars[id].x, y-gs.chars[id].y);
+
+      if ((charid==-1) || (dist<closest))
+      {
+        charid=id;
+        closest=dist;
+      }
+    }
+  }
+
+  return charid;
+}
+
+// Find the nearest char of type included in tileids to given x, y point, and the one nearest to tx, ty
+// (within reach) being the target last headed for, either being -1 when there's none
+void
+findtarget(const struct gamestate & gs, const real x, const real y, const real tx, const real ty, const real reach, const std::vector<uint16_t> & tileids, int32_t & nearest, int32_t & current)
+{
+	counter_add(COUNTER_FINDNEAREST);
+
+	real closest=0;
+	real closesttarget=reach;
+
+	nearest=-1;
+	current=-1;
+
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+	{
+		if (std::count(tileids.begin(), tileids.end(), gs.chars[id].id)>0)
+		{
+			real dist=calcHypotenuse(x-gs.chars[id].x, y-gs.chars[id].y);
+			real targetdist=calcHypotenuse(tx-gs.chars[id].x, ty-gs.chars[id].y);
+
+			if ((nearest==-1) || (dist<closest))
+			{
+				nearest=id;
+				closest=dist;
+			}
+
+			if (targetdist<=closesttarget)
+			{
+				current=id;
+				closesttarget=targetdist;
+			}
+		}
+	}
+}
+
+// Check if agent needs a path to target nid, targets still within RETARGETDRIFT of where the last
+// path was planned to keep that path
+bool
+needspath(const struct gamestate & gs, const uint32_t id, const int32_t nid)
+{
+	if ((gs.chars[id].dx==-1) && (gs.chars[id].dy==-1))
+		return true;
+
+	return (calcHypotenuse(gs.chars[id].dx-gs.chars[nid].x, gs.chars[id].dy-gs.chars[nid].y)>RETARGETDRIFT);
+}
+
+// Plan a path for agent to target nid
+std::vector<int32_t>
+planpath(const struct gamestate & gs, const uint32_t id, const int32_t nid)
+{
+	return pathfinder(gs,
+	(Math_floor(gs.chars[id].y/TILESIZE)*gs.width)+Math_floor(gs.chars[id].x/TILESIZE)
+	,
+	(Math_floor(gs.chars[nid].y/TILESIZE)*gs.width)+Math_floor(gs.chars[nid].x/TILESIZE)
+	);
+}
+
+uint32_t
+countchars(const struct gamestate & gs, const std::vector<uint16_t> & tileids)
+{
+	counter_add(COUNTER_COUNTCHARS);
+
+	uint32_t found=0;
+
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+		if (std::count(tileids.begin(), tileids.end(), gs.chars[id].id)>0)
+			found++;
+
+	return found;
+}
+
+bool
+islevelcompleted(const struct gamestate & gs)
+{
+  // This is defined as ..
+  //   no grubs
+  //   no flies
+  //   5 or more bees for level 1, then 6, 7, 8, e.t.c.
+
+  return (
+	(countchars(gs, {55,56})==0) &&
+	(countchars(gs, {53,54})==0) &&
+	(countchars(gs, {51,52})>=(uint8_t)(gs.level+5))
+	);
+}
+
+// Check if char is an agent which makes decisions
+bool
+isagent(const uint8_t id)
+{
+	return ((id>=51) && (id<=56));
+}
+
+uint32_t
+aibuckets(const struct gamestate & gs)
+{
+	uint32_t buckets=(gs.ai.buckets>0)?gs.ai.buckets:AIBUCKETS;
+
+	// Far agents decide half as often while frames are running over, but not in replays as they
+	// have to play out the same as they were recorded
+	if ((governor_sheds(gs.gov, SHEDAI)) && (gs.replaymode==REPLAYOFF))
+		buckets*=2;
+
+	return buckets;
+}
+
+uint32_t
+aibudget(const struct gamestate & gs)
+{
+	return (gs.ai.budget>0)?gs.ai.budget:AIBUDGET;
+}
+
+// Pick the agents which make decisions this update. Those near the view always do, far ones take
+// turns by bucket, sweeping through the chars from where the budget last ran out
+void
+scheduleAI(struct gamestate & gs)
+{
+	uint32_t numchars=gs.chars.size();
+	uint32_t buckets=aibuckets(gs);
+	uint32_t budget=aibudget(gs);
+	uint32_t decided=0;
+	uint32_t deferred=0;
+
+	gs.aidecide.assign(numchars, 0);
+	gs.aitick++;
+
+	if (gs.aicursor>=numchars)
+		gs.aicursor=0;
+
+	uint32_t cursor=gs.aicursor;
+
+	for (uint32_t n=0; n<numchars; n++)
+	{
+		uint32_t id=(cursor+n)%numchars;
+		const struct gamechar & c=gs.chars[id];
+
+		if (!isagent(c.id))
+			continue;
+
+		bool near=((c.x+TILESIZE)>=(gs.xoffset-AIMARGIN)) && (c.x<(gs.xoffset+XMAX+AIMARGIN)) &&
+			((c.y+TILESIZE)>=(gs.yoffset-AIMARGIN)) && (c.y<(gs.yoffset+YMAX+AIMARGIN));
+
+		// Far ones wait for their bucket's turn
+		if ((!near) && (((id+gs.aitick)%buckets)!=0))
+			continue;
+
+		if ((!near) && (decided>=budget))
+		{
+			// Out of budget, pick up from here next time
+			if (deferred==0)
+				gs.aicursor=id;
+
+			deferred++;
+			continue;
+		}
+
+		if (!near)
+			decided++;
+
+		gs.aidecide[id]=1;
+		counter_add(COUNTER_AIDECISIONS);
+	}
+
+	counter_add(COUNTER_AIDEFERRED, deferred);
+}
+
+// Check if agent makes decisions this update, ones added during the update always do
+bool
+aidecides(const struct gamestate & gs, const uint32_t id)
+{
+	return ((id>=gs.aidecide.size()) || (gs.aidecide[id]!=0));
+}
+
+// Work out what an agent intends to do this update. This only reads the game state, so agents can be
+// decided in parallel, with updatecharAI() then carrying out their intents one by one
+void
+decideAI(const struct gamestate & gs, const uint32_t id, struct aiintent & intent)
+{
+	const struct gamechar & c=gs.chars[id];
+	int32_t nid=-1; // next target id
+
+	intent.action=AINONE;
+	intent.other=-1;
+	intent.replan=false;
+	intent.stuck=false;
+	intent.target=-1;
+	intent.path.clear();
+
+	// Dwelling agents don't decide anything, nor do those waiting their turn
+	if ((c.dwell>0) || (!aidecides(gs, id)))
+		return;
+
+	switch (c.id)
+	{
+		case 51: // bee
+		case 52:
+		{
+			// Only decide when not following a path
+			if (c.path.size()>0)
+				break;
+
+			// Check if overlapping flowers, or a hive when we have pollen for it
+			for (uint32_t id2=0; id2<gs.chars.size(); id2++)
+			{
+				if (((gs.chars[id2].id==32) || (gs.chars[id2].id==33) || (((gs.chars[id2].id==36) || (gs.chars[id2].id==37)) && (c.pollen>0))) &&
+					(overlap(c.x, c.y, TILESIZE, TILESIZE, gs.chars[id2].x, gs.chars[id2].y, TILESIZE, TILESIZE)))
+				{
+					intent.action=((gs.chars[id2].id==32) || (gs.chars[id2].id==33))?AIPOLLINATE:AIDEPOSIT;
+					intent.other=id2;
+					break;
+				}
+			}
+
+			// Only look for some place to go if not stopping here
+			if (intent.action!=AINONE)
+				break;
+
+			int32_t hid=-1; // next hive id
+			int32_t fid=-1; // next flower id
+
+			// Find nearest hive
+			hid=findnearestchar(gs, c.x, c.y, {36, 37});
+
+			// Find nearest flower
+			fid=findnearestchar(gs, c.x, c.y, {32, 33});
+
+			// If we have any pollen, go to nearest hive (if there is one)
+			if ((hid!=-1) && (c.pollen>0))
+				nid=hid;
+
+			// However, if we need more pollen and there is a flower available, go there first
+			if ((fid!=-1) && (c.pollen<5))
+				nid=fid;
+
+			// If something was found, check if we are already going there
+			if (nid!=-1)
+			{
+				// If our next point of interest is not where we are already headed, then re-route
+				if (needspath(gs, id, nid))
+				{
+					intent.replan=true;
+					intent.target=nid;
+					intent.path=planpath(gs, id, nid);
+				}
+			}
+			else
+			{
+				// No new targets found, so go to player
+				intent.replan=true;
+				intent.target=-1;
+				intent.path=pathfinder(gs,
+				(Math_floor(c.y/TILESIZE)*gs.width)+Math_floor(c.x/TILESIZE)
+				,
+				(Math_floor(gs.y/TILESIZE)*gs.width)+Math_floor(gs.x/TILESIZE)
+				);
+			}
+		} // bee scope
+			break;
+
+		case 53: // zombee
+		case 54:
+		{
+			int32_t tid=-1; // current target id
+
+			// Check for collision with a bee with pollen to steal, or a hive to break
+			for (uint32_t id2=0; id2<gs.chars.size(); id2++)
+			{
+				if (((((gs.chars[id2].id==51) || (gs.chars[id2].id==52)) && (gs.chars[id2].pollen>0)) || (gs.chars[id2].id==36)) &&
+					(overlap(c.x, c.y, TILESIZE, TILESIZE, gs.chars[id2].x, gs.chars[id2].y, TILESIZE, TILESIZE)))
+				{
+					intent.action=(gs.chars[id2].id==36)?AIBREAK:AISTEAL;
+					intent.other=id2;
+					break;
+				}
+			}
+
+			// Find nearest hive/bee, and the one we are already headed for (if it's still about)
+			findtarget(gs, c.x, c.y, c.dx, c.dy, (c.dx==-1)?-1:RETARGETDRIFT, {36, 51, 52}, nid, tid);
+
+			// Stick with the current target unless another is nearer by a margin
+			if ((tid!=-1) && (tid!=nid) &&
+				(calcHypotenuse(c.x-gs.chars[tid].x, c.y-gs.chars[tid].y)<=
+				(calcHypotenuse(c.x-gs.chars[nid].x, c.y-gs.chars[nid].y)+RETARGETMARGIN)))
+				nid=tid;
+
+			// If something was found, check if we are already going there
+			if (nid!=-1)
+			{
+				// If our next point of interest has moved on or changed, then re-route
+				if (needspath(gs, id, nid))
+				{
+					intent.replan=true;
+					intent.target=nid;
+					intent.path=planpath(gs, id, nid);
+				}
+			}
+			else
+				intent.stuck=true;
+		} // zombee scope
+			break;
+
+		case 55: // grub
+		case 56:
+			// Check if overlapping a toadstool
+			for (uint32_t id2=0; id2<gs.chars.size(); id2++)
+			{
+				if (((gs.chars[id2].id==30) || (gs.chars[id2].id==31)) &&
+				(overlap(c.x+(TILESIZE/2), c.y+(TILESIZE/2), 1, 1, gs.chars[id2].x, gs.chars[id2].y, TILESIZE, TILESIZE)))
+				{
+					intent.action=AIEAT;
+					intent.other=id2;
+					break;
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+// Decide what every char intends to do this update, over the worker pool when there is one
+void
+decideagents(struct gamestate & gs)
+{
+	TRACE_SCOPE(gs, "decideagents");
+	uint32_t numchars=gs.chars.size();
+	uint32_t chunks=(numchars+AICHUNK-1)/AICHUNK;
+	const struct gamestate & state=gs; // Deciding only reads the game state
+
+	gs.aiintents.resize(numchars);
+
+	if ((gs.pool==NULL) || (gs.pool->numworkers<=1) || (chunks<=1))
+	{
+		for (uint32_t id=0; id<numchars; id++)
+			decideAI(state, id, gs.aiintents[id]);
+
+		return;
+	}
+
+	// Workers other than this thread count into their own counters, which are added in after
+	gs.aicounters.resize(gs.pool->numworkers);
+	for (uint32_t w=0; w<gs.aicounters.size(); w++)
+		counters_reset(gs.aicounters[w]);
+
+	workpool_run(*gs.pool, chunks, [&](const uint32_t worker, const uint32_t chunk)
+	{
+		struct countersscope counting((worker>0)?gs.aicounters[worker]:gs.count);
+		struct tracehelperscope tracing(worker>0);
+
+		for (uint32_t id=chunk*AICHUNK; (id<numchars) && (id<((chunk+1)*AICHUNK)); id++)
+			decideAI(state, id, gs.aiintents[id]);
+	});
+
+	for (uint32_t w=1; w<gs.aicounters.size(); w++)
+		for (int i=0; i<COUNTER_COUNT; i++)
+			counter_add((countertype)i, gs.aicounters[w].current[i]);
+}
+
+// Move an agent onwards along its path, returns true on arriving at the end of it
+bool
+followpath(struct gamestate & gs, const uint32_t id, const real speed)
+{
+	int32_t nextx=Math_floor(gs.chars[id].path[0]%gs.width)*TILESIZE;
+	int32_t nexty=Math_floor(gs.chars[id].path[0]/gs.width)*TILESIZE;
+	int32_t deltax=(int32_t)abs(nextx-gs.chars[id].x);
+	int32_t deltay=(int32_t)abs(nexty-gs.chars[id].y);
+
+	// Check if we have arrived at the current path node
+	if ((deltax<=(TILESIZE/2)) && (deltay<=(TILESIZE/2)))
+	{
+		// We are here, so move on to next path node
+		gs.chars[id].path.erase(gs.chars[id].path.begin());
+
+		return (gs.chars[id].path.size()==0);
+	}
+
+	// Move onwards, following path
+	if ((deltax!=0) && (nextx!=gs.chars[id].x))
+	{
+		gs.chars[id].hs=(nextx<gs.chars[id].x)?-speed:speed;
+		gs.chars[id].x+=gs.chars[id].hs;
+		gs.chars[id].flip=(gs.chars[id].hs<0);
+
+		if (gs.chars[id].x<0)
+			gs.chars[id].x=0;
+	}
+
+	if (deltay!=0)
+	{
+		gs.chars[id].y+=(nexty<gs.chars[id].y)?-speed:speed;
+
+		if (gs.chars[id].x<0)
+			gs.chars[id].x=0;
+	}
+
+	return false;
+}
+
+// Take on a new path, or wait a bit when there's nowhere to go
+void
+takepath(struct gamestate & gs, const uint32_t id, struct aiintent & intent)
+{
+	if (intent.stuck)
+	{
+		// Nowhere to go next, dwell a bit to stop pathfinder running constantly
+		gs.chars[id].dwell=(2*FPS);
+		return;
+	}
+
+	if (!intent.replan)
+		return;
+
+	gs.chars[id].path=std::move(intent.path);
+	gs.chars[id].replans++;
+	counter_add(COUNTER_REPLANS);
+
+	if (intent.target!=-1)
+	{
+		gs.chars[id].dx=(int32_t)gs.chars[intent.target].x;
+		gs.chars[id].dy=(int32_t)gs.chars[intent.target].y;
+	}
+	else
+	if (gs.chars[id].path.size()<=1)
+	{
+		// Didn't find the player on the map, dwell a bit to stop pathfinder running constantly
+		gs.chars[id].dwell=(2*FPS);
+	}
+}
+
+// Carry out what agents decided, one by one in order, resolving clashes as each goes. A char another has
+// already used up this update (a flower picked clean, a toadstool eaten) is passed over until next time
+void
+updatecharAI(struct gamestate & gs)
+{
+	uint32_t id;
+	real nx; // new x position
+	struct aiintent none={AINONE, -1, false, false, -1, {}}; // Chars added this update decide next time
+
+	scheduleAI(gs);
+	decideagents(gs);
+
+	TRACE_SCOPE(gs, "applyagents");
+
+	for (id=0; id<gs.chars.size(); id++)
+	{
+		struct aiintent & intent=(id<gs.aiintents.size())?gs.aiintents[id]:none;
+		int32_t id2=intent.other;
+
+		// Decrease hurt timer
+		if ((gs.chars[id].htime)>0) gs.chars[id].htime--;
+
+		switch (gs.chars[id].id)
+		{
+			case 31: // toadstool
+			case 33: // flower
+				gs.chars[id].growtime--;
+				if (gs.chars[id].growtime<=0)
+				{
+					gs.chars[id].health=HEALTHPLANT;
+					gs.chars[id].id--; // Switch tile to bigger version of plant
+				}
+				break;
+
+			case 51: // bee
+			case 52:
+				// Check if dwelling
+				if (gs.chars[id].dwell>0)
+				{
+					gs.chars[id].dwell--;
+
+					continue;
+				}
+
+				// Check if following a path, then move to next node
+				if (gs.chars[id].path.size()>0)
+				{
+					if (followpath(gs, id, SPEEDBEE))
+					{
+						// If following player, wait a bit here
+						if (gs.chars[id].dx==-1)
+							gs.chars[id].dwell=(2*FPS);
+
+						// Set a null destination
+						gs.chars[id].dx=-1;
+						gs.chars[id].dy=-1;
+					}
+
+					break;
+				}
+
+				switch (intent.action)
+				{
+					case AIPOLLINATE:
+						// Flower may have been picked clean already
+						if (((gs.chars[id2].id!=32) && (gs.chars[id2].id!=33)) || (gs.chars[id2].del))
+							break;
+
+						gs.chars[id].dwell=(2*FPS);
+
+						gs.chars[id].pollen++; // Increase pollen that the bee is carrying
+
+						gs.chars[id2].health--; // Decrease flower health
+						if (gs.chars[id2].health<=0)
+						{
+							if (gs.chars[id2].id==32) // If it's big flower, change to small flower, then the bee can get a bit more pollen
+							{
+								gs.chars[id2].health=HEALTHPLANT;
+								gs.chars[id2].growtime=(GROWTIME+Math_floor(rng(gs)*120));
+								gs.chars[id2].id=33;
+							}
+							else
+								gs.chars[id2].del=true; // Remove plant
+						}
+						break;
+
+					case AIDEPOSIT:
+						// Pollen may have been stolen on the way
+						if (gs.chars[id].pollen<=0)
+							break;
+
+						gs.chars[id].dwell=(2*FPS);
+
+						// Transfer pollen from bee to hive
+						gs.chars[id2].pollen+=gs.chars[id].pollen;
+						gs.chars[id].pollen=0;
+
+						// If hive has enough pollen, spawn another bee
+						if ((gs.chars[id2].pollen>10) && (countchars(gs, {51,52})<gs.maxbees))
+						{
+							struct gamechar obj;
+
+							obj.id=51;
+							obj.x=gs.chars[id2].x;
+							obj.y=gs.chars[id2].y;
+							obj.flip=false;
+							obj.hs=0;
+							obj.vs=0;
+							obj.dwell=(5*FPS);
+							obj.htime=0;
+							obj.pollen=0;
+							obj.dx=-1;
+							obj.dy=-1;
+							obj.replans=0;
+							obj.phase=anim_phase(Math_floor(obj.x/TILESIZE), Math_floor(obj.y/TILESIZE));
+							obj.del=false;
+							obj.health=0;
+							obj.growtime=0;
+
+							gs.chars[id2].pollen-=10;
+							gs.chars.push_back(obj);
+
+							generateparticles(gs, gs.chars[id].x+(TILESIZE/2), gs.chars[id].y+(TILESIZE/2), 16, 16, 0, 0, 0);
+
+							int32_t beesneeded=((int32_t)(gs.level+5)-(int32_t)countchars(gs, {51,52}));
+
+							if (beesneeded<=0)
+							{
+								if (!islevelcompleted(gs))
+									showmessagebox(gs, "[53]Remove all threats", 3*FPS);
+							}
+							else
+								showmessagebox(gs, "[51]"+std::to_string(beesneeded)+" more bees needed", 3*FPS);
+						}
+						break;
+
+					default:
+						takepath(gs, id, intent);
+						break;
+				}
+				break;
+
+			case 53: // zombee
+			case 54:
+				// Check if dwelling
+				if (gs.chars[id].dwell>0)
+				{
+					gs.chars[id].dwell--; // Reduce collision preventer
+
+					continue; // Stop further processing, we are still dwelling
+				}
+
+				switch (intent.action)
+				{
+					case AISTEAL:
+						// Steal some pollen if it still has any
+						if (gs.chars[id2].pollen>0)
+						{
+							gs.chars[id2].pollen--;
+							gs.chars[id].pollen++;
+
+							// Don't allow further collisions for a while
+							gs.chars[id].dwell=(5*FPS);
+						}
+						break;
+
+					case AIBREAK:
+						// Hive may have been broken already
+						if (gs.chars[id2].id!=36)
+							break;
+
+						// Break hive
+						gs.chars[id2].id++;
+
+						// See if there is any pollen in the hive
+						if (gs.chars[id2].pollen>0)
+						{
+							// Loose half the pollen in the hive
+							gs.chars[id2].pollen=Math_floor(gs.chars[id2].pollen/2);
+						}
+
+						// Don't allow further collisions for a while
+						gs.chars[id].dwell=(10*FPS);
+						break;
+
+					default:
+						break;
+				}
+
+				takepath(gs, id, intent);
+
+				// Check if following a path, if so do move to next node
+				if ((gs.chars[id].path.size()>0) && (followpath(gs, id, SPEEDZOMBEE)))
+				{
+					// Path completed so wait a bit
+					gs.chars[id].dwell=(2*FPS);
+
+					// Set a null destination
+					gs.chars[id].dx=-1;
+					gs.chars[id].dy=-1;
+				}
+				break;
+
+			case 55: // grub
+			case 56:
+				// If dwelling, don't process any further
+				if (gs.chars[id].dwell>0)
+				{
+					gs.chars[id].dwell--;
+					gs.chars[id].hs=0; // Prevent movement
+
+					continue;
+				}
+
+				// If overlapping a toadstool which hasn't been eaten up already, stop and eat some
+				if ((intent.action==AIEAT) && ((gs.chars[id2].id==30) || (gs.chars[id2].id==31)) && (!gs.chars[id2].del))
+				{
+					gs.chars[id].health++; // Increase grub health
+					gs.chars[id].dwell=(3*FPS);
+
+					gs.chars[id2].health--; // Decrease toadstool health
+					if (gs.chars[id2].health<=0)
+					{
+						if (gs.chars[id2].id==30) // If it's a tall toadstool, change to small toadstool, then eat a bit more
+						{
+							gs.chars[id2].health=HEALTHPLANT;
+							gs.chars[id2].growtime=(GROWTIME+Math_floor(rng(gs)*120));
+							gs.chars[id2].id=31;
+						}
+						else
+							gs.chars[id2].del=true;
+					}
+
+					break;
+				}
+
+				// Not eating, nor moving
+				if (gs.chars[id].hs==0)
+				{
+					gs.chars[id].hs=(rng(gs)<0.5)?-SPEEDGRUB:SPEEDGRUB; // Nothing eaten so move onwards
+					gs.chars[id].flip=(gs.chars[id].hs<0);
+
+					// If this grub is well fed, turn it into a zombee
+					if ((gs.chars[id].health>(HEALTHGRUB*1.5)) && (countchars(gs, {53,54})<gs.maxflies))
+					{
+						gs.chars[id].id=53;
+						gs.chars[id].health=HEALTHZOMBEE;
+						gs.chars[id].pollen=0;
+						gs.chars[id].dwell=(5*FPS);
+
+						generateparticles(gs, gs.chars[id].x+(TILESIZE/2), gs.chars[id].y+(TILESIZE/2), 16, 16, 0, 0, 0);
+
+						break;
+					}
+				}
+
+				nx=(gs.chars[id].x+=gs.chars[id].hs); // calculate new x position
+				if ((collide(gs, nx, gs.chars[id].y, TILESIZE, TILESIZE)) || // blocked by something
+				(
+				(!collide(gs, nx+(gs.chars[id].flip?(TILESIZE/2)*-1:(TILESIZE)/2), gs.chars[id].y, TILESIZE, TILESIZE)) && // not blocked forwards
+				(!collide(gs, nx+(gs.chars[id].flip?(TILESIZE/2)*-1:(TILESIZE)/2), gs.chars[id].y+(TILESIZE/2), TILESIZE, TILESIZE)) // not blocked forwards+down (i.e. edge)
+				))
+				{
+					// Turn around
+					gs.chars[id].hs*=-1;
+					gs.chars[id].flip=!gs.chars[id].flip;
+				}
+				else
+					gs.chars[id].x=nx;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	// Remove anything marked for deletion
+	id=gs.chars.size();
+	while (id--)
+	{
+		if (gs.chars[id].del)
+		{
+			gs.chars.erase(gs.chars.begin()+id);
+			counter_add(COUNTER_ERASED);
+		}
+	}
+}
+void
+checkspawn(struct gamestate & gs)
+{
+	gs.spawntime--;
+	if (gs.spawntime<=0)
+	{
+		TRACE_SCOPE_ARG(gs, "spawnscan", "candidates");
+		float mindist=(((rng(gs)<0.5)?3:4)*TILESIZE); // How far away from all other chars
+		int32_t reach=Math_floor(mindist/TILESIZE)+1;
+
+		// Sort chars by tile, so those near each spawn point are found by searching each row near it,
+		// rather than checking every spawn point against every char
+		gs.spawnnear.clear();
+		for (uint32_t id=0; id<gs.chars.size(); id++)
+			gs.spawnnear.push_back({Math_floor(gs.chars[id].y/TILESIZE), Math_floor(gs.chars[id].x/TILESIZE), id});
+
+		auto before=[](const struct chartile & a, const struct chartile & b)
+		{
+			return (a.y!=b.y)?(a.y<b.y):(a.x<b.x);
+		};
+
+		std::sort(gs.spawnnear.begin(), gs.spawnnear.end(), before);
+
+		// Create list of free spawn points, distance is measured from the flat edge below each
+		const struct leveldata ld=getleveldata(gs);
+
+		gs.spawnfree.clear();
+		for (uint32_t i=0; i<ld.numspawns; i++)
+		{
+			const int32_t x=ld.spawns[i].x;
+			const int32_t y=ld.spawns[i].y+1;
+			bool blocked=false;
+
+			for (int32_t cy=y-reach; (cy<=(y+reach)) && (!blocked); cy++)
+			{
+				auto near=std::lower_bound(gs.spawnnear.begin(), gs.spawnnear.end(), (struct chartile){cy, x-reach, 0}, before);
+
+				for (; (near!=gs.spawnnear.end()) && (near->y==cy) && (near->x<=(x+reach)); near++)
+				{
+					if (calcHypotenuse((x*TILESIZE)-gs.chars[near->id].x, (y*TILESIZE)-gs.chars[near->id].y)<mindist)
+					{
+						blocked=true;
+						break;
+					}
+				}
+			}
+
+			if (!blocked)
+				gs.spawnfree.push_back(i);
+		}
+
+		TRACE_ARG(gs.spawnfree.size());
+
+		if (gs.spawnfree.size()>0)
+		{
+			const struct spawnpoint & sp=ld.spawns[gs.spawnfree[Math_floor(rng(gs)*gs.spawnfree.size())]]; // Pick random spawn point from list
+			uint8_t spawnid=(rng(gs)<0.6)?33:31; // Pick randomly between flowers and toadstools
+			struct gamechar obj;
+
+			obj.id=spawnid;
+			obj.x=(sp.x*TILESIZE);
+			obj.y=(sp.y*TILESIZE);
+			obj.flip=false;
+			obj.hs=0;
+			obj.vs=0;
+			obj.dwell=(5*FPS);
+			obj.htime=0;
+			obj.pollen=0;
+			obj.dx=-1;
+			obj.dy=-1;
+			obj.replans=0;
+			obj.phase=anim_phase(Math_floor(obj.x/TILESIZE), Math_floor(obj.y/TILESIZE));
+			obj.del=false;
+			obj.health=HEALTHPLANT;
+			obj.growtime=GROWTIME;
+
+			// Add spawned item to front of chars
+			gs.chars.insert(gs.chars.begin(), obj);
+		}
+
+		gs.spawntime=SPAWNTIME; // Set up for next spawn check
+	}
+}
+
+void
+levelinfo(struct gamestate & gs)
+{
+	// Write level number and title
+	write((3*3)*13, 40, std::string("Level ")+std::to_string(gs.level+1), 3, 255,191,0, 1);
+	const char *title=getlevel(gs, gs.level).title;
+
+	write((XMAX/2)-((strlen(title)/2)*8), YMAX/2, title, 2, 255,255,255, 1);
+
+	// Indicate what is required to progress to next level
+	write(9*12, YMAX-20, std::string("Increase colony to ")+std::to_string(gs.level+5)+std::string(" bees"), 1, 255,191,0, 1);
+}
+
+void
+startplaying(struct gamestate & gs)
+{
+	gs.state=STATEPLAYING;
+	loadlevel(gs);
+}
+
+void
+newlevel(struct gamestate & gs, const uint8_t level)
+{
+  std::vector<std::string> hints;
+
+	if (level>=numlevels(gs))
+		return;
+
+	gs.state=STATENEWLEVEL;
+
+	// Set current level to new one
+	gs.level=level;
+
+	// Clear any messageboxes left on screen
+	gs.msgqueue.clear();
+	gs.msgboxtime=0;
+
+	// Add hints depending on level
+	switch (level)
+	{
+		case 0:
+			hints.push_back("[10]Welcome to JS13K entry\nby picosonic");
+			hints.push_back("[50]Shoot enemies\nwith the honey gun");
+			hints.push_back("[55]Grubs turn into Zombees\nwhen they eat toadstools");
+			hints.push_back("[53]Zombees chase bees\nsteal pollen and honey\nand break hives");
+			hints.push_back("[51]Bees collect pollen from flowers\nto make pollen in their hives");
+			hints.push_back("[30]Clear away toadstools to prevent\ngrubs turning into ZomBees and\nmake space for flowers to grow");
+			break;
+
+		case 1:
+			hints.push_back("[45]Watch out for gravity toggles");
+			break;
+
+		case 2:
+			hints.push_back("[50]Solve the maze\nto find your prize");
+			break;
+
+		case 3:
+			hints.push_back("[50]Use gravity toggle\nto get honey gun");
+			break;
+
+		case 4:
+			hints.push_back("[45]Race to the top\nwith care");
+			break;
+
+		case 5:
+			hints.push_back("[55]Hop to it before the\ngrubs change to Zombees");
+			break;
+
+		case 6:
+			hints.push_back("[40]Take a leap of faith");
+			break;
+
+		default:
+			break;
+	}
+
+	// Queue up all the hints as message boxes one after the other
+	for (uint32_t n=0; n<hints.size(); n++)
+		showmessagebox(gs, hints[n], 3*FPS);
+	
+	sequence_start(gs.seq, SEQUENCELEVELSTART);
+}
+
+// Start the intro animation
+void
+resettointro(struct gamestate & gs)
+{
+	sequence_start(gs.seq, SEQUENCEINTRO);
+}
+
+// How far through a sequence of a given length the last step was, as a percentage
+float
+sequencepercent(const struct gamestate & gs, const uint64_t frames)
+{
+	return ((float)gs.seq.frame/(float)frames)*100;
+}
+
+// End game animation, bees fly around the screen until it's done or skipped
+struct sequence
+endgamesequence(struct gamestate & gs)
+{
+	while (gs.state==STATECOMPLETE)
+	{
+		// Check if done or control key/gamepad pressed, keys held from finishing the last level don't skip it
+		if ((sequencepercent(gs, ENDGAMEFRAMES)>=98) || (anymovementkeywaspressed(gs)))
+			gs.state=STATEINTRO;
+		else
+		{
+			// Add Bees
+			if (gs.seq.frame==0)
+			{
+				gs.chars.clear();
+
+				for (int n=0; n<50; n++)
+				{
+					struct gamechar obj;
+
+					obj.id=51;
+					obj.x=Math_floor(fxrng(gs)*XMAX);
+					obj.y=Math_floor(fxrng(gs)*XMAX);
+					obj.flip=false;
+					obj.hs=fxrng(gs)<0.5?-SPEEDBEE*2:SPEEDBEE*2;
+					obj.vs=fxrng(gs)<0.5?-SPEEDBEE*2:SPEEDBEE*2;
+					obj.dwell=0;
+					obj.htime=0;
+					obj.del=false;
+					obj.health=0;
+
+					obj.growtime=0;
+					obj.pollen=0;
+					obj.dx=-1;
+					obj.dy=-1;
+					obj.replans=0;
+					obj.phase=anim_phase(Math_floor(obj.x/TILESIZE), Math_floor(obj.y/TILESIZE));
+
+					gs.chars.push_back(obj);
+				}
+			}
+
+			// Move bees onwards
+			for (uint32_t i=0; i<gs.chars.size(); i++)
+			{
+				gs.chars[i].x+=gs.chars[i].hs;
+				if ((gs.chars[i].x<0) || (gs.chars[i].x+TILESIZE>XMAX))
+					gs.chars[i].hs*=-1;
+
+				gs.chars[i].y+=gs.chars[i].vs;
+				if ((gs.chars[i].y<0) || (gs.chars[i].y+TILESIZE>YMAX))
+					gs.chars[i].vs*=-1;
+			}
+		}
+
+		co_await sequence_nextframe(gs.seq);
+	}
+
+	resettointro(gs);
+}
+
+// Draw end game animation
+void
+drawendgame(struct gamestate & gs)
+{
+	write(35, 30, "CONGRATULATIONS", 4, 255,191,0, 1);
+	write(15, (YMAX/2)+20, "The Queen Bee thanks you for helping", 2, 255,255,255, 1);
+	write(50, (YMAX/2)+40, "to save the bees and planet", 2, 255,255,255, 1);
+
+	// Draw rabbit
+	drawsprite(gs, anim_frame(ANIMWALK, gs.tick, 0), XMAX/2, Math_floor((YMAX/2)-(TILESIZE/2)), false);
+
+	// Draw bees
+	for (uint32_t i=0; i<gs.chars.size(); i++)
+		drawsprite(gs, anim_charframe(gs.chars[i].id, gs.tick, gs.chars[i].phase), gs.chars[i].x, gs.chars[i].y, false);
+}
+
+// Update function called once per frame
+void
+update(struct gamestate & gs)
+{
+	// Animation frames are worked out from this when drawn
+	gs.tick++;
+
+	if (gs.state==STATEPLAYING)
+	{
+		// Apply keystate/physics to player
+		{
+			struct profilescope scope(gs.prof, PHASE_UPDATEMOVEMENTS);
+			TRACE_SCOPE(gs, "updatemovements");
+			updatemovements(gs);
+		}
+
+		// Update other character movements / AI
+		{
+			struct profilescope scope(gs.prof, PHASE_UPDATECHARAI);
+			TRACE_SCOPE(gs, "updatecharAI");
+			updatecharAI(gs);
+		}
+
+		// Check for player/character/collectable collisions
+		{
+			struct profilescope scope(gs.prof, PHASE_UPDATEPLAYERCHAR);
+			TRACE_SCOPE(gs, "updateplayerchar");
+			updateplayerchar(gs);
+		}
+
+		// Check for spawn event
+		{
+			struct profilescope scope(gs.prof, PHASE_CHECKSPAWN);
+			TRACE_SCOPE(gs, "checkspawn");
+			checkspawn(gs);
+		}
+
+		// Check for level completed
+		if ((gs.state==STATEPLAYING) && (islevelcompleted(gs)))
+		{
+			gs.xoffset=0;
+			gs.yoffset=0;
+
+			if ((uint8_t)(gs.level+1)==numlevels(gs))
+			{
+				// End of game
+				gs.state=STATECOMPLETE;
+
+				sequence_start(gs.seq, SEQUENCEENDGAME);
+			}
+			else
+				newlevel(gs, gs.level+1);
+		}
+	}
+}
+
+static const char sg_introtitle[]=" BEE KIND ";
+
+// Intro animation, the title is spelt out as the characters are introduced, until it's done or skipped
+struct sequence
+introsequence(struct gamestate & gs)
+{
+	// Check if done or control key/gamepad pressed, keys held from skipping the endgame don't skip it
+	while ((sequencepercent(gs, INTROFRAMES)<98) && (!anymovementkeywaspressed(gs)))
+	{
+		float tenth=Math_floor(sequencepercent(gs, INTROFRAMES)/10);
+
+		if (sg_introtitle[(int)tenth]!=' ')
+			generateparticles(gs, (tenth+0.4)*(8*4), 30, 4, 8, 255, 191, 0);
+
+		// Animate the particles
+		particlecheck(gs);
+
+		co_await sequence_nextframe(gs.seq);
+	}
+
+	newlevel(gs, 0);
+}
+
+// Draw intro animation
+void
+drawintro(struct gamestate & gs)
+{
+	float percent=sequencepercent(gs, INTROFRAMES);
+	float tenth=Math_floor(percent/10);
+
+	for (int cc=0; cc<10; cc++)
+	{
+		if (cc<tenth)
+			write(cc*(8*4), 30, std::string("")+sg_introtitle[cc], 5, 255,191,0, 1);
+	}
+
+	// Introduce characters
+	// grub
+	drawsprite(gs, anim_frame(ANIMGRUB, gs.tick, 0), XMAX-Math_floor((percent/100)*XMAX)+50, Math_floor((YMAX/2)+(TILESIZE*2)), true);
+	write(XMAX-Math_floor((percent/100)*XMAX)+50+TILESIZE, Math_floor((YMAX/2)+(TILESIZE*2.5)), "GRUB - eats toadstools, becomes ZOMBEE", 1, 240,240,240, 1);
+
+	// zombee
+	drawsprite(gs, anim_frame(ANIMZOMBEE, gs.tick, 0), XMAX-Math_floor((percent/100)*XMAX)+TILESIZE+50, Math_floor((YMAX/2)+TILESIZE), true);
+	write(XMAX-Math_floor((percent/100)*XMAX)+(TILESIZE*2)+50, Math_floor((YMAX/2)+(TILESIZE*1.3)), "ZOMBEE - steals pollen, breaks hives", 1, 240,240,240, 1);
+
+	// Draw rabbit
+	drawsprite(gs, anim_frame(ANIMWALK, gs.tick, 0), Math_floor((percent/100)*XMAX), Math_floor((YMAX/2)-(TILESIZE/2)), false);
+
+	// Draw bees
+	drawsprite(gs, anim_frame(ANIMBEE, gs.tick, 0), XMAX-Math_floor((percent/100)*XMAX), Math_floor((YMAX/2)+(TILESIZE*2)), true);
+	drawsprite(gs, anim_frame(ANIMBEE, gs.tick, 1), XMAX-Math_floor((percent/100)*XMAX)+TILESIZE, Math_floor((YMAX/2)+TILESIZE), true);
+
+	// Draw controls
+	if ((Math_floor(percent)%16)<=8)
+	{
+		std::string keys=((Math_floor(percent/2)%32)<16)?"WASD":"ZQSD";
+		write((XMAX/4)+(TILESIZE*2), YMAX-20, keys+"/CURSORS + ENTER/SPACE/SHIFT", 1, 240,240,240, 1);
+		write((XMAX/4)+(TILESIZE*2), YMAX-10, "or use GAMEPAD", 1, 240,240,240, 1);
+
+		// Draw JS13k gamepad
+		drawsprite(gs, 10, (XMAX/4)+(TILESIZE/2), YMAX-TILESIZE, false);
+	}
+
+	// Draw the particles
+	drawparticles(gs);
+}
+
+// Level start, the level title shows for a while before play begins
+struct sequence
+levelstartsequence(struct gamestate & gs)
+{
+	co_await sequence_at(gs.seq, 3*FPS);
+
+	startplaying(gs);
+}
+
+// Nothing to run, for ids which aren't a sequence
+struct sequence
+nosequence(struct gamestate &)
+{
+	co_return;
+}
+
+// Build the coroutine for a sequence
+struct sequence
+createsequence(struct gamestate & gs, const uint8_t id)
+{
+	switch (id)
+	{
+		case SEQUENCEINTRO:
+			return introsequence(gs);
+
+		case SEQUENCELEVELSTART:
+			return levelstartsequence(gs);
+
+		case SEQUENCEENDGAME:
+			return endgamesequence(gs);
+
+		default:
+			break;
+	}
+
+	return nosequence(gs);
+}
+
+void
+game_seed(struct gamestate & gs, const uint64_t seed)
+{
+	gs.seed=seed;
+}
+
+void
+game_stress(struct gamestate & gs, const struct stressconfig & stress)
+{
+	gs.stress=stress;
+}
+
+void
+game_aischedule(struct gamestate & gs, const struct aiconfig & ai)
+{
+	gs.ai=ai;
+}
+
+uint32_t
+game_aibudget(const struct gamestate & gs)
+{
+	return aibudget(gs);
+}
+
+void
+game_governor(struct gamestate & gs, const bool enabled, const uint32_t budget)
+{
+	governor_reset(gs.gov, enabled, (budget>0)?budget:(1000000/FPS));
+}
+
+void
+game_workpool(struct gamestate & gs, struct workpool *pool)
+{
+	gs.pool=pool;
+}
+
+void
+game_levelpack(struct gamestate & gs, const struct levelpack *pack)
+{
+	gs.pack=pack;
+}
+
+void
+game_initialise(struct gamestate & gs)
+{
+	reset_gamestate(gs);
+
+	resettointro(gs);
+}
+
+void
+game_start(struct gamestate & gs, const uint8_t level)
+{
+	reset_gamestate(gs);
+
+	newlevel(gs, level);
+}
+
+void
+game_record(struct gamestate & gs, struct replay & rec, const uint8_t level)
+{
+	// Start game as normal, then record from the first update
+	if (level>0)
+		game_start(gs, level-1);
+	else
+		game_initialise(gs);
+
+	replay_reset(rec, level, gs.seed);
+
+	gs.replay=&rec;
+	gs.replaymode=REPLAYRECORD;
+}
+
+void
+game_playback(struct gamestate & gs, struct replay & rec)
+{
+	replay_rewind(rec);
+
+	// Start game exactly as it was when recorded
+	game_seed(gs, rec.seed);
+
+	if (rec.level>0)
+		game_start(gs, rec.level-1);
+	else
+		game_initialise(gs);
+
+	gs.replay=&rec;
+	gs.replaymode=REPLAYPLAY;
+}
+
+void
+game_stopreplay(struct gamestate & gs)
+{
+	if (gs.replaymode==REPLAYRECORD)
+		replay_flush(*gs.replay);
+
+	gs.replay=NULL;
+	gs.replaymode=REPLAYOFF;
+}
+
+bool
+game_replaying(const struct gamestate & gs)
+{
+	return ((gs.replaymode==REPLAYPLAY) && (!replay_finished(*gs.replay)));
+}
+
+bool
+game_combopressed(const struct gamestate & gs, const uint32_t combo)
+{
+	return (((gs.input&combo)==combo) && ((gs.inputpressed&combo)!=0));
+}
+
+// Hash of the simulation state, to check runs are identical
+uint32_t
+game_checksum(const struct gamestate & gs)
+{
+	uint32_t hash=2166136261u; // FNV-1a
+
+	auto add = [&](const void *data, const size_t len)
+	{
+		for (size_t i=0; i<len; i++)
+			hash=(hash^((const uint8_t *)data)[i])*16777619u;
+	};
+
+	add(&gs.x, sizeof(gs.x));
+	add(&gs.y, sizeof(gs.y));
+	add(&gs.life, sizeof(gs.life));
+	add(&gs.level, sizeof(gs.level));
+	add(&gs.state, sizeof(gs.state));
+	add(&gs.gamerng, sizeof(gs.gamerng));
+
+	for (uint32_t id=0; id<gs.chars.size(); id++)
+	{
+		add(&gs.chars[id].id, sizeof(gs.chars[id].id));
+		add(&gs.chars[id].x, sizeof(gs.chars[id].x));
+		add(&gs.chars[id].y, sizeof(gs.chars[id].y));
+		add(&gs.chars[id].health, sizeof(gs.chars[id].health));
+		add(&gs.chars[id].pollen, sizeof(gs.chars[id].pollen));
+	}
+
+	return hash;
+}
+
+void
+game_save(const struct gamestate & gs, std::vector<uint8_t> & data)
+{
+	struct savewriter w={data};
+	uint32_t i;
+
+	data.clear();
+	data.reserve(1024);
+
+	w.u8('B'); w.u8('K'); w.u8('S'); w.u8('S');
+	w.u16(SAVESTATEVERSION);
+	w.u8(REALFRAC);
+
+	// Physics
+	w.num(gs.gravity);
+	w.num(gs.terminalvelocity);
+	w.num(gs.friction);
+
+	// Player
+	w.num(gs.x); w.num(gs.y);
+	w.num(gs.px); w.num(gs.py);
+	w.num(gs.sx); w.num(gs.sy);
+	w.num(gs.vs); w.num(gs.hs);
+	w.flag(gs.jump); w.flag(gs.fall); w.flag(gs.duck);
+	w.u32(gs.htime);
+	w.u32(gs.invtime);
+	w.u8(gs.dir);
+	w.num(gs.hsp); w.num(gs.vsp);
+	w.num(gs.speed); w.num(gs.jumpspeed);
+	w.u32(gs.coyote);
+	w.u32(gs.life);
+	w.flag(gs.flip);
+	w.flag(gs.gun);
+	w.u32(gs.gunheat);
+
+	w.u32(gs.shots.size());
+	for (i=0; i<gs.shots.size(); i++)
+	{
+		w.u8(gs.shots[i].id);
+		w.num(gs.shots[i].x); w.num(gs.shots[i].y);
+		w.flag(gs.shots[i].flip);
+		w.u8(gs.shots[i].dir);
+		w.u32(gs.shots[i].ttl);
+		w.flag(gs.shots[i].del);
+	}
+
+	// Level
+	w.u8(gs.level);
+	w.u16(gs.width); w.u16(gs.height);
+	w.u32(gs.xoffset); w.u32(gs.yoffset);
+	w.flag(gs.topdown);
+	w.u32(gs.spawntime);
+	w.u32(gs.maxbees); w.u32(gs.maxflies);
+	w.u32(gs.stress.bees); w.u32(gs.stress.zombees);
+	w.u32(gs.stress.grubs); w.u32(gs.stress.plants);
+	w.u32(gs.ai.buckets); w.u32(gs.ai.budget);
+	w.u32(gs.aitick); w.u32(gs.aicursor);
+
+	// Characters
+	w.u32(gs.chars.size());
+	for (i=0; i<gs.chars.size(); i++)
+	{
+		const struct gamechar & c=gs.chars[i];
+
+		w.u8(c.id);
+		w.num(c.x); w.num(c.y);
+		w.flag(c.flip);
+		w.num(c.hs); w.num(c.vs);
+		w.u32(c.dwell);
+		w.u32(c.htime);
+		w.flag(c.del);
+		w.u32(c.health);
+		w.u32(c.growtime);
+		w.u32(c.pollen);
+		w.u32(c.dx); w.u32(c.dy);
+		w.u32(c.replans);
+		w.u8(c.phase);
+
+		w.u32(c.path.size());
+		for (uint32_t n=0; n<c.path.size(); n++)
+			w.u32(c.path[n]);
+	}
+	w.u32(gs.tick);
+
+	// Particles
+	const struct particlepool & p=gs.particles;
+
+	w.u32(p.count);
+	for (i=0; i<p.count; i++)
+	{
+		w.num(p.x[i]); w.num(p.y[i]);
+		w.num(p.dx[i]); w.num(p.dy[i]);
+		w.num(p.t[i]);
+		w.u8(p.r[i]); w.u8(p.g[i]); w.u8(p.b[i]);
+		w.num(p.a[i]);
+		w.u8(p.s[i]);
+	}
+
+	// Parallax
+	w.u32(gs.parallax.size());
+	for (i=0; i<gs.parallax.size(); i++)
+	{
+		w.u32(gs.parallax[i].t);
+		w.f32(gs.parallax[i].x); w.f32(gs.parallax[i].y); w.f32(gs.parallax[i].z);
+	}
+
+	// Input and random numbers
+	w.u32(gs.input);
+	w.u64(gs.seed);
+	for (i=0; i<4; i++) w.u32(gs.gamerng.s[i]);
+	for (i=0; i<4; i++) w.u32(gs.fxrng.s[i]);
+
+	w.u8(gs.state);
+
+	// Scripted sequence, rebuilt from its id and frame on restore
+	w.u8(gs.seq.id);
+	w.u64(gs.seq.frame);
+
+	// Message boxes
+	w.str(gs.msgboxtext);
+	w.u32(gs.msgboxtime);
+	w.u32(gs.msgqueue.size());
+	for (i=0; i<gs.msgqueue.size(); i++)
+	{
+		w.str(gs.msgqueue[i].msgboxtext);
+		w.u32(gs.msgqueue[i].msgboxtime);
+	}
+}
+
+bool
+game_restore(struct gamestate & gs, const uint8_t *data, const size_t size)
+{
+	struct savereader r={data, size, 0, true};
+	struct gamestate ns={}; // Restore into new state, so gs is untouched on failure
+	uint32_t i;
+	uint32_t count;
+
+	if ((r.u8()!='B') || (r.u8()!='K') || (r.u8()!='S') || (r.u8()!='S') || (r.u16()!=SAVESTATEVERSION) || (r.u8()!=REALFRAC))
+		return false;
+
+	// Physics
+	ns.gravity=r.num();
+	ns.terminalvelocity=r.num();
+	ns.friction=r.num();
+
+	// Player
+	ns.x=r.num(); ns.y=r.num();
+	ns.px=r.num(); ns.py=r.num();
+	ns.sx=r.num(); ns.sy=r.num();
+	ns.vs=r.num(); ns.hs=r.num();
+	ns.jump=r.flag(); ns.fall=r.flag(); ns.duck=r.flag();
+	ns.htime=r.u32();
+	ns.invtime=r.u32();
+	ns.dir=r.u8();
+	ns.hsp=r.num(); ns.vsp=r.num();
+	ns.speed=r.num(); ns.jumpspeed=r.num();
+	ns.coyote=r.u32();
+	ns.life=r.u32();
+	ns.flip=r.flag();
+	ns.gun=r.flag();
+	ns.gunheat=r.u32();
+
+	count=r.u32();
+	if (!r.fits(count, 16)) return false;
+	ns.shots.resize(count);
+	for (i=0; i<count; i++)
+	{
+		ns.shots[i].id=r.u8();
+		ns.shots[i].x=r.num(); ns.shots[i].y=r.num();
+		ns.shots[i].flip=r.flag();
+		ns.shots[i].dir=r.u8();
+		ns.shots[i].ttl=r.u32();
+		ns.shots[i].del=r.flag();
+	}
+
+	// Level
+	ns.level=r.u8();
+	ns.width=r.u16(); ns.height=r.u16();
+	ns.xoffset=r.u32(); ns.yoffset=r.u32();
+	ns.topdown=r.flag();
+	ns.spawntime=r.u32();
+	ns.maxbees=r.u32(); ns.maxflies=r.u32();
+	ns.stress.bees=r.u32(); ns.stress.zombees=r.u32();
+	ns.stress.grubs=r.u32(); ns.stress.plants=r.u32();
+	ns.ai.buckets=r.u32(); ns.ai.budget=r.u32();
+	ns.aitick=r.u32(); ns.aicursor=r.u32();
+
+	// Level pack belongs to the host, and must be the same one the snapshot was taken with
+	ns.pack=gs.pack;
+
+	if (ns.level>=numlevels(ns))
+		return false;
+
+	const struct level lvl=getlevel(ns, ns.level);
+
+	// On the title screen of a level the previous one (if any) is still loaded, it's not used again so the map is left empty
+	const bool maploaded=((ns.width==lvl.width) && (ns.height==lvl.height));
+
+	if (maploaded)
+	{
+		unpacklayer(ns, lvl.tiles, lvl.tilessize, lvl.packed);
+		prepareleveldata(ns);
+	}
+
+	// Characters
+	count=r.u32();
+	if (!r.fits(count, 51)) return false;
+	ns.chars.resize(count);
+	for (i=0; i<count; i++)
+	{
+		struct gamechar & c=ns.chars[i];
+
+		c.id=r.u8();
+		c.x=r.num(); c.y=r.num();
+		c.flip=r.flag();
+		c.hs=r.num(); c.vs=r.num();
+		c.dwell=r.u32();
+		c.htime=r.u32();
+		c.del=r.flag();
+		c.health=r.u32();
+		c.growtime=r.u32();
+		c.pollen=r.u32();
+		c.dx=r.u32(); c.dy=r.u32();
+		c.replans=r.u32();
+		c.phase=r.u8();
+
+		uint32_t pathlen=r.u32();
+		if (!r.fits(pathlen, 4)) return false;
+		c.path.resize(pathlen);
+		for (uint32_t n=0; n<pathlen; n++)
+			c.path[n]=r.u32();
+	}
+	ns.tick=r.u32();
+
+	// Particles
+	count=r.u32();
+	if ((count>PARTICLEMAX) || (!r.fits(count, 28))) return false;
+	struct particlepool & p=ns.particles;
+	particles_clear(p);
+	p.count=count;
+	for (i=0; i<count; i++)
+	{
+		p.x[i]=r.num(); p.y[i]=r.num();
+		p.dx[i]=r.num(); p.dy[i]=r.num();
+		p.t[i]=r.num();
+		p.r[i]=r.u8(); p.g[i]=r.u8(); p.b[i]=r.u8();
+		p.a[i]=r.num();
+		p.s[i]=r.u8();
+	}
+
+	// Parallax
+	count=r.u32();
+	if (!r.fits(count, 16)) return false;
+	ns.parallax.resize(count);
+	for (i=0; i<count; i++)
+	{
+		ns.parallax[i].t=r.u32();
+		ns.parallax[i].x=r.f32(); ns.parallax[i].y=r.f32(); ns.parallax[i].z=r.f32();
+	}
+
+	// Input and random numbers
+	ns.input=r.u32();
+	ns.seed=r.u64();
+	for (i=0; i<4; i++) ns.gamerng.s[i]=r.u32();
+	for (i=0; i<4; i++) ns.fxrng.s[i]=r.u32();
+
+	ns.state=r.u8();
+
+	// Only the intro and a level's title screen can be without the map, as neither draws nor plays it
+	if ((!maploaded) && (ns.state!=STATEINTRO) && (ns.state!=STATENEWLEVEL))
+		return false;
+
+	// Scripted sequence
+	ns.seq.id=r.u8();
+	ns.seq.frame=r.u64();
+
+	if (ns.seq.id>SEQUENCEENDGAME)
+		return false;
+
+	// Message boxes
+	ns.msgboxtext=r.str();
+	ns.msgboxtime=r.u32();
+	count=r.u32();
+	if (!r.fits(count, 6)) return false;
+	ns.msgqueue.resize(count);
+	for (i=0; i<count; i++)
+	{
+		ns.msgqueue[i].msgboxtext=r.str();
+		ns.msgqueue[i].msgboxtime=r.u32();
+	}
+
+	if (!r.ok)
+		return false;
+
+	// Recording/playback belongs to the host, so carries on as it was
+	ns.replaymode=gs.replaymode;
+	ns.replay=gs.replay;
+	ns.prof=gs.prof;
+	ns.gov=gs.gov;
+	ns.trace=gs.trace;
+	ns.pool=gs.pool;
+	ns.count=gs.count;
+
+	gs=std::move(ns);
+
+	return true;
+}
+
+// Draw frame profile, rolling stats per phase (us), a sparkline of frame times and event counters
+void
+drawprofile(struct gamestate & gs)
+{
+	const uint32_t budget=(1000000/FPS); // frame budget (us)
+	const int16_t sparkx=10; // sparkline position
+	const int16_t sparky=YMAX-10;
+	const int16_t sparkh=40; // sparkline height for a full budget
+	uint8_t dtop=1;
+
+	// Shed level of the governor, the only thing left once the overlay itself is shed
+	if (gs.gov.enabled)
+	{
+		char line[32];
+
+		snprintf(line, sizeof(line), "SHED %u %s (PEAK %u)", gs.gov.level, sg_shednames[gs.gov.level], gs.gov.peak);
+		write(10, font_height*dtop, line, 1, DEBUGTXTCOLOUR);
+	}
+
+	if (governor_sheds(gs.gov, SHEDDEBUG))
+		return;
+
+	dtop=3;
+	write(10, font_height*(dtop++), "PHSE  MIN   AVG   P99", 1, DEBUGTXTCOLOUR);
+
+	for (int i=0; i<PHASE_COUNT; i++)
+	{
+		struct profilestats stats=profile_stats(gs.prof, (profilephase)i);
+		char line[32];
+
+		snprintf(line, sizeof(line), "%-4s%5u %5u %5u", sg_phasenames[i], stats.min, stats.avg, stats.p99);
+		write(10, font_height*(dtop++), line, 1, DEBUGTXTCOLOUR);
+	}
+
+	// Sparkline of frame times, oldest on the left, red when over budget
+	for (uint32_t i=0; i<gs.prof.count; i++)
+	{
+		uint32_t frame=gs.prof.frames[(gs.prof.pos+PROFILEHISTORY-gs.prof.count+i)%PROFILEHISTORY];
+		int16_t h=(frame*sparkh)/budget;
+
+		if (h>(sparkh*2)) h=sparkh*2;
+		if (h<1) h=1;
+
+		if (frame>budget)
+			platform_set_colour(255, 0, 0, 192);
+		else
+			platform_set_colour(0, 160, 0, 192);
+
+		platform_solid_rectangle(sparkx+i, sparky-h, 1, h);
+	}
+
+	// Budget line
+	platform_set_colour(0, 0, 0, 128);
+	platform_solid_rectangle(sparkx, sparky-sparkh, PROFILEHISTORY, 1);
+
+	// Hot path counters, last frame, average and peak per frame over the history
+	dtop=3;
+	write(110, font_height*(dtop++), "CNTR   LAST    AVG   PEAK", 1, DEBUGTXTCOLOUR);
+
+	for (int i=0; i<COUNTER_COUNT; i++)
+	{
+		char line[32];
+
+		snprintf(line, sizeof(line), "%-5s%6u %6u %6u", sg_counternames[i], gs.count.last[i], counter_average(gs.count, (countertype)i), counter_peak(gs.count, (countertype)i));
+		write(110, font_height*(dtop++), line, 1, DEBUGTXTCOLOUR);
+	}
+}
+
+// Draw a frame
+void
+draw(struct gamestate & gs)
+{
+	struct profilescope scope(gs.prof, PHASE_DRAW);
+	TRACE_SCOPE(gs, "draw");
+
+	// Clear screen
+	if (gs.state==STATEPLAYING)
+		platform_set_colour(BGCOLOUR);
+	else
+		platform_set_colour(BLACKCOLOUR);
+
+	platform_clear();
+
+	// Draw what needs drawing
+	switch (gs.state)
+	{
+		case STATEINTRO:
+			drawintro(gs);
+			break;
+
+		case STATENEWLEVEL:
+			levelinfo(gs);
+			break;
+
+		case STATECOMPLETE:
+			drawendgame(gs);
+			break;
+
+		case STATEPLAYING:
+			// Scroll to keep player in view
+			scrolltoplayer(gs, true);
+
+			// Draw the parallax
+			if (!governor_sheds(gs.gov, SHEDPARALLAX))
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWPARALLAX);
+				TRACE_SCOPE(gs, "drawparallax");
+				drawparallax(gs);
+			}
+
+			// Draw the level
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWLEVEL);
+				TRACE_SCOPE(gs, "drawlevel");
+				drawlevel(gs);
+			}
+
+			// Draw the chars
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWCHARS);
+				TRACE_SCOPE(gs, "drawchars");
+				drawchars(gs);
+			}
+
+			// Draw the player
+			if ((gs.invtime>0) && (!governor_sheds(gs.gov, SHEDPARTICLES)))
+				generateparticles(gs, gs.x+(TILESIZE/2), gs.y+TILESIZE, 4, 2, 44, 197, 246); // leave a trail when invulnerable
+
+			if ((gs.htime==0) || ((gs.htime%30)<=15)) // Flash when hurt
+				drawsprite(gs, playerframe(gs), gs.x, gs.y, gs.flip);
+
+			// Draw the shots
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWSHOTS);
+				TRACE_SCOPE(gs, "drawshots");
+				drawshots(gs);
+			}
+
+			// Draw the particles
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWPARTICLES);
+				TRACE_SCOPE(gs, "drawparticles");
+				drawparticles(gs);
+			}
+
+			// Draw any visible messagebox
+			{
+				struct profilescope scope(gs.prof, PHASE_DRAWMSGBOX);
+				TRACE_SCOPE(gs, "drawmsgbox");
+				drawmsgbox(gs);
+			}
+
+			// Draw game stats
+			if ((ispressed(gs, INPUT_DIPSW1)) && (!governor_sheds(gs.gov, SHEDDEBUG)))
+			{
+				uint8_t dtop=1;
+
+				write(XMAX-(12*font_width), font_height*(dtop++), "GRB : "+std::to_string(countchars(gs, {55, 56})), 1, DEBUGTXTCOLOUR);
+				write(XMAX-(12*font_width), font_height*(dtop++), "ZOM : "+std::to_string(countchars(gs, {53, 54})), 1, DEBUGTXTCOLOUR);
+				write(XMAX-(12*font_width), font_height*(dtop++), "BEE : "+std::to_string(countchars(gs, {51, 52})), 1, DEBUGTXTCOLOUR);
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	// Draw frame profile
+	if ((gs.state==STATEPLAYING) && (ispressed(gs, INPUT_DIPSW1)))
+		drawprofile(gs);
+}
+
+void
+game_draw(struct gamestate & gs)
+{
+	struct countersscope counting(gs.count);
+
+	draw(gs);
+
+	// Frame is complete once it has been drawn
+	profile_endframe(gs.prof);
+	governor_endframe(gs.gov, profile_lastframe(gs.prof));
+
+	counter_set(COUNTER_PARTICLES, gs.particles.count);
+	counters_endframe(gs.count);
+
+	TRACE_COUNTER(gs, "chars", gs.chars.size());
+	TRACE_COUNTER(gs, "particles", gs.particles.count);
+	TRACE_COUNTER(gs, "shed", gs.gov.level);
+}
+
+void
+game_update(struct gamestate & gs)
+{
+	struct countersscope counting(gs.count);
+	struct profilescope scope(gs.prof, PHASE_UPDATE);
+	TRACE_SCOPE(gs, "update");
+
+	// Chars move at most a few tiles a frame, so chunks wanted now cover all of this frame's updates
+	streammap(gs);
+
+	gs.inputpressed=0;
+
+	for (int i=0; i<UPDATES_PER_FRAME; i++)
+	{
+		latchinputs(gs);
+
+		update(gs); // simulate 60 fps (kinda)
+	}
+
+	// Step any scripted sequence
+	{
+		struct profilescope scope(gs.prof, PHASE_SEQUENCE);
+		TRACE_SCOPE(gs, "sequence_step");
+		sequence_step(gs.seq, gs, createsequence);
+	}
+}
@@ -0,0 +1,80 @@
+//=============================================================================
+//	FILE:					game.h
+//	SYSTEM:
+//	DESCRIPTION:	Entry points into the game simulation
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_GAME_H
+#define GUARD_BEEKIND_GAME_H
+
+#include <cstdint>
+#include <vector>
+#include "gamestate.h"
+
+// Simulation updates run per displayed frame
+static constexpr int			UPDATES_PER_FRAME				= 2;
+
+// Set seed for random numbers, used from the next game_initialise() or game_start()
+void game_seed(struct gamestate & gs, const uint64_t seed);
+
+// Set extra populations to add to each level as it loads, all zero for normal play
+void game_stress(struct gamestate & gs, const struct stressconfig & stress);
+
+// Set how often agents away from the view make decisions, and how many they can make in one update,
+// zero fields take the defaults
+void game_aischedule(struct gamestate & gs, const struct aiconfig & ai);
+
+// Most decisions agents away from the view make in one update, as configured
+uint32_t game_aibudget(const struct gamestate & gs);
+
+// Shed cosmetic work while frames take longer than budget (us) to update and draw, 0 for one frame at
+// the game's frame rate. Gameplay is never shed, agents away from the view only decide less often
+// outside of replays
+void game_governor(struct gamestate & gs, const bool enabled, const uint32_t budget);
+
+// Decide AI over a pool of workers, or NULL to decide serially (the results are the same either way).
+// Pool must outlive the game, and only be used by one game at a time
+void game_workpool(struct gamestate & gs, struct workpool *pool);
+
+// Add the levels in a pack after the built in ones, or NULL for none. Pack must outlive the game
+void game_levelpack(struct gamestate & gs, const struct levelpack *pack);
+
+// Reset game state and start the intro sequence
+void game_initialise(struct gamestate & gs);
+
+// Reset game state and jump straight to the start of a level
+void game_start(struct gamestate & gs, const uint8_t level);
+
+// Start a new game recording inputs into rec, level 0 runs the intro otherwise 1 based level
+void game_record(struct gamestate & gs, struct replay & rec, const uint8_t level);
+
+// Start a new game playing back inputs from rec
+void game_playback(struct gamestate & gs, struct replay & rec);
+
+// Stop any recording or playback
+void game_stopreplay(struct gamestate & gs);
+
+// Check if a replay is still being played back
+bool game_replaying(const struct gamestate & gs);
+
+// Check if a combo of inputs (a mask of platform_input bits) was completed this frame, all held with one just pressed
+bool game_combopressed(const struct gamestate & gs, const uint32_t combo);
+
+// Hash of the simulation state, to compare runs
+uint32_t game_checksum(const struct gamestate & gs);
+
+// Snapshot the full game state into data
+void game_save(const struct gamestate & gs, std::vector<uint8_t> & data);
+
+// Restore game state from a snapshot, leaves gs untouched if the snapshot isn't valid
+bool game_restore(struct gamestate & gs, const uint8_t *data, const size_t size);
+
+// Advance the simulation and any scripted sequence, called once per frame
+void game_update(struct gamestate & gs);
+
+// Draw the current frame
+void game_draw(struct gamestate & gs);
+
+#endif // ! defined GUARD_BEEKIND_GAME_H
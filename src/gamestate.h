@@ -0,0 +1,219 @@
+//=============================================================================
+//	FILE:					gamestate.h
+//	SYSTEM:
+//	DESCRIPTION:	State for a single game instance
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_GAMESTATE_H
+#define GUARD_BEEKIND_GAMESTATE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "counters.h"
+#include "fixed.h"
+#include "governor.h"
+#include "leveldata.h"
+#include "particles.h"
+#include "profiler.h"
+#include "random.h"
+#include "sequence.h"
+#include "tilemap.h"
+#include "trace.h"
+
+struct replay;
+struct levelpack;
+struct workpool;
+
+// Character attributes
+struct gamechar
+{
+	uint8_t id; // tile id
+	real x; // x position
+	real y; // y position
+	bool flip; // if char is horizontally flipped
+	real hs; // horizontal speed
+	real vs; // vertical speed
+	int32_t dwell; // time (in frames) to dwell before next AI
+	int32_t htime; // hurt timer
+	bool del; // if char needs deleting
+
+	int32_t health; // remaining health
+	int32_t growtime; // time (in frames) until next growth
+	int32_t pollen; // amount of pollen carried/stored
+
+	int32_t dx; // destination x position
+	int32_t dy; // destination y position
+	std::vector<int32_t> path; // pathfinding set of nodes (tile indices)
+	uint32_t replans; // paths planned so far, to check how often it retargets
+	uint8_t phase; // frames its animation is offset by, so chars don't all move in step
+};
+
+// What an agent intends to do this update, decided from the state at the start of it
+struct aiintent
+{
+	uint8_t action; // what to do to another char (AINONE, AIPOLLINATE, e.t.c.)
+	int32_t other; // char to do it to
+	bool replan; // path holds a new path to target
+	bool stuck; // nowhere to go, so wait a bit
+	int32_t target; // char the new path goes to, -1 for the player
+	std::vector<int32_t> path; // new path (tile indices)
+};
+
+// Gun shots
+struct shot
+{
+	uint8_t id; // tile id
+	real x; // x position
+	real y; // y position
+	bool flip; // if char is horizontally flipped
+	int8_t dir; //direction (-1=left, 0=none, 1=right)
+	int32_t ttl; // time (in frames) to live
+	bool del; // if shot needs deleting
+};
+
+// Char by the tile it's in, for finding chars near a tile
+struct chartile
+{
+	int32_t y; // tile row
+	int32_t x; // tile column
+	uint32_t id; // char
+};
+
+// Parallax
+struct parallax
+{
+	uint32_t t; // type (tile group)
+	float x; // x position
+	float y; // y position
+	float z; // z position
+};
+
+// Message box queue
+struct msgboxitem
+{
+	std::string msgboxtext; // text to show in current messagebox
+	uint32_t msgboxtime; // timer for showing current messagebox
+};
+
+// Stress test populations, added to each level as it loads
+struct stressconfig
+{
+	uint32_t bees; // extra bees
+	uint32_t zombees; // extra zombees
+	uint32_t grubs; // extra grubs
+	uint32_t plants; // extra flowers and toadstools
+};
+
+// Decision scheduling of agents away from the view, zero for the defaults
+struct aiconfig
+{
+	uint32_t buckets; // updates between decisions of a far agent, 1 lets them decide every update
+	uint32_t budget; // most decisions made by far agents in one update
+};
+
+// Game state
+struct gamestate
+{
+	// physics in pixels per frame @ 60fps
+	real gravity;
+	real terminalvelocity;
+	real friction;
+
+	// Main character
+	real x; // x position
+	real y; // y position
+	real px; // previous x position
+	real py; // previous y position
+	real sx; // start x position (for current level)
+	real sy; // start y position (for current level)
+	real vs; // vertical speed
+	real hs; // horizontal speed
+	bool jump; // jumping
+	bool fall; // falling
+	bool duck; // ducking
+	int32_t htime; // hurt timer following enemy collision
+	int32_t invtime; // invulnerable time following JS13k collection
+	int8_t dir; //direction (-1=left, 0=none, 1=right)
+	real hsp; // max horizontal speed
+	real vsp; // max vertical speed
+	real speed; // walking speed
+	real jumpspeed; // jumping speed
+	int32_t coyote; // coyote timer (time after leaving ground where you can still jump)
+	int32_t life; // remaining "life force" as percentage
+	bool flip; // if player is horizontally flipped
+	bool gun; // if the player holds the gun
+	std::vector<struct shot> shots; // an array of shots from the gun
+	uint32_t gunheat; // countdown to next shot
+
+	// Level attributes
+	uint8_t level; // Level number (0 based)
+	uint16_t width; // Width in tiles
+	uint16_t height; // height in tiles
+	int32_t xoffset; // current view offset from left (horizontal scroll)
+	int32_t yoffset; // current view offset from top (vertical scroll)
+	bool topdown; // is the level in top-down mode, otherwise it's 2D platformer
+	int32_t spawntime; // time in frames until next spawn event
+	struct tilemap map; // tiles of current level
+	struct tilemap regions; // connected areas of current level
+	const struct levelpack *pack; // extra levels after the built in ones, NULL when none, kept across resets
+	std::vector<struct spawnpoint> spawnbuffer; // spawn points of a level pack level, built in ones are generated offline
+	std::vector<uint8_t> regionbuffer; // connected areas of a level pack level (RLE packed), built in ones are generated offline
+	std::vector<struct chartile> spawnnear; // chars sorted by tile, reused by each spawn check
+	std::vector<uint32_t> spawnfree; // spawn points free for current check, reused by each spawn check
+	uint32_t maxbees; // bee population cap
+	uint32_t maxflies; // zombee population cap
+	struct stressconfig stress; // extra agents to add to each level, kept across resets
+	struct aiconfig ai; // decision scheduling of far agents, kept across resets
+	uint32_t aitick; // AI updates so far, picks the bucket of far agents due to decide
+	uint32_t aicursor; // char the sweep of far agents resumes from, once the budget runs out
+	std::vector<uint8_t> aidecide; // agents making decisions this update, reused by each update
+	std::vector<struct aiintent> aiintents; // what each char intends to do this update, reused by each update
+	struct workpool *pool; // workers to decide AI with in parallel, NULL to decide serially, kept across resets
+	std::vector<struct counters> aicounters; // counts made by each worker while deciding AI
+
+	// Characters
+	std::vector<struct gamechar> chars;
+	uint32_t tick; // updates since reset, animation frames are worked out from it when drawn
+
+	// Particles
+	struct particlepool particles;
+
+	// Parallax
+	std::vector<struct parallax> parallax;
+
+	// Input
+	uint32_t input; // inputs latched for current update (1<<platform_input)
+	uint32_t inputpressed; // inputs which went down during this frame's updates
+	uint8_t replaymode; // replay mode, 0=off, 1=recording, 2=playing
+	struct replay *replay; // recording being made or played back
+
+	// Random numbers
+	uint64_t seed; // seed for current game
+	struct rngstate gamerng; // gameplay stream
+	struct rngstate fxrng; // cosmetic stream
+
+	// Game state
+	uint8_t state; // state machine, 0=intro, 1=menu, 2=playing, 3=complete
+	
+	// Scripted sequence running (intro, level start, end game)
+	struct sequencer seq;
+
+	// Messagebox popup
+	std::string msgboxtext; // text to show in current messagebox
+	uint32_t msgboxtime; // timer for showing current messagebox
+	std::vector<struct msgboxitem> msgqueue; // Message box queue
+
+	// Frame profiler
+	struct profiler prof;
+	struct governor gov; // sheds cosmetic work while frames run over budget, kept across resets
+	struct tracebuffer *trace; // event trace, NULL when not tracing
+	struct counters count; // hot path event counters
+
+	// music
+	// TODO
+};
+
+#endif // ! defined GUARD_BEEKIND_GAMESTATE_H
@@ -0,0 +1,136 @@
+//=============================================================================
+//	FILE:					levelprep.h
+//	SYSTEM:
+//	DESCRIPTION:	Derived level data, generated by levelprep from levels.h, do not edit
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_GENERATED_LEVELPREP_H
+#define GUARD_BEEKIND_GENERATED_LEVELPREP_H
+
+#include "leveldata.h"
+
+#define LEVELPREP_HASH 0x079d012bu
+
+// Bee Keeper Bunny
+static constexpr struct spawnpoint sg_level1spawns[] = {
+  {14,2},{2,3},{3,3},{4,3},{12,3},{7,4},{8,4},{9,4},{10,4},{0,5},{23,6},{24,6},{25,6},{26,6},{27,6},{28,6},
+  {29,6},{30,6},{31,6},{32,6},{33,6},{34,6},{35,6},{1,7},{2,7},{3,7},{4,7},{5,7},{6,7},{10,7},{11,7},{12,7},
+  {13,7},{15,7},{16,7},{17,7},{18,7},{19,7},{20,7},{21,7},{2,10},{3,10},{4,10},{5,10},{6,10},{7,10},{8,10},{9,10},
+  {10,10},{11,10},{12,10},{13,10},{14,10},{15,10},{16,10},{17,10},{18,10},{19,10},{20,10},{21,10},{22,10},{23,10},{24,10},{25,10},
+  {26,10},{27,10},{28,10},{29,10},{30,10},{31,10},{32,10},{33,10},{34,10}
+};
+static constexpr uint8_t sg_level1regions[] = {
+  163,1,163,1,136,1,0,151,1,0,1,141,1,0,139,1,0,135,1,1,1,130,0,134,1,0,1,0,143,1,0,131,1,1,1,0,1,0,1,1,131,0,152,1,0,133,1,0,155,1,0,133,1,0,133,1,0,135,1,140,0,135,0,1,
+  1,139,0,140,1,0,162,1,0,163,1,1,1,160,0,1
+};
+
+// Bee Whizz
+static constexpr struct spawnpoint sg_level2spawns[] = {
+  {6,1},{7,1},{8,1},{9,1},{10,1},{11,1},{12,1},{13,1},{14,1},{17,1},{18,1},{19,1},{20,1},{21,1},{0,2},{22,2},
+  {23,2},{24,2},{25,2},{26,2},{34,2},{35,2},{18,3},{19,3},{27,3},{28,3},{29,3},{30,3},{31,3},{32,3},{33,3},{3,4},
+  {15,4},{16,4},{17,4},{20,5},{22,5},{23,5},{24,5},{25,5},{26,5},{27,5},{28,5},{29,5},{30,5},{31,5},{32,5},{33,5},
+  {34,5},{0,6},{16,6},{17,6},{18,6},{25,7},{26,7},{27,7},{28,7},{29,7},{30,7},{31,7},{15,8},{0,9},{1,9},{2,9},
+  {3,9},{4,9},{5,9},{6,9},{7,9},{8,9},{9,9},{10,9},{11,9},{12,9},{13,9},{14,9},{20,10},{22,10},{32,10},{2,11},
+  {3,11},{4,11},{5,11},{6,11},{7,11},{8,11},{9,11},{10,11},{11,11},{12,11},{13,11},{14,11},{15,11},{16,11},{19,11},{21,11},
+  {23,11},{33,11},{34,11},{35,11}
+};
+static constexpr uint8_t sg_level2regions[] = {
+  163,0,132,1,0,157,1,132,1,137,0,1,1,132,0,141,1,0,131,1,0,135,1,0,134,1,132,0,134,1,0,0,132,1,0,1,0,133,1,0,130,1,0,0,134,1,135,0,1,130,1,0,1,1,0,1,0,133,1,130,0,1,0,143,
+  1,147,1,0,1,140,0,1,0,142,1,130,0,1,0,1,0,138,1,0,1,143,1,130,0,1,0,1,0,1,1,134,0,1,1,0,1,142,1,0,136,1,0,132,1,0,1,1,0,1,142,0,137,1,0,132,1,0,1,1,0,1,147,1,
+  0,1,0,135,1,0,0,130,1,1,1,142,0,1,1,132,0,135,1,131,0
+};
+
+// Bee Amazed
+static constexpr struct spawnpoint sg_level3spawns[] = {
+  {14,12},{15,12},{16,12},{17,12},{4,26},{5,26},{6,26},{7,26},{8,26},{9,26},{10,26},{11,26},{15,26},{16,26},{17,26},{18,26},
+  {19,26},{20,26},{21,26},{22,26},{23,26},{24,26},{25,26},{26,26},{27,26},{28,26},{29,26},{6,29},{13,29},{14,29},{15,29},{16,29},
+  {18,29},{19,29},{20,29},{21,29},{22,29},{23,29},{24,29},{25,29},{26,29},{27,29},{28,29},{29,29},{30,29},{31,29},{32,29},{33,29}
+};
+static constexpr uint8_t sg_level3regions[] = {
+  131,0,153,1,131,0,0,2,2,155,0,2,2,0,0,144,2,0,141,2,0,0,0,2,134,0,2,0,133,2,0,2,138,0,2,0,0,3,0,2,0,134,2,0,133,2,0,2,0,136,2,0,2,0,4,3,0,2,0,2,2,140,0,2,
+  0,2,134,0,2,0,2,0,4,3,0,2,0,143,2,0,2,0,132,2,0,2,0,2,0,4,3,0,2,136,0,2,0,2,2,132,0,2,132,0,2,0,2,0,2,0,4,3,0,2,0,130,2,0,130,2,0,2,0,135,2,0,130,2,
+  0,2,0,2,0,2,0,4,3,0,2,0,130,2,0,2,0,2,0,2,137,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,130,2,0,2,0,2,0,131,2,0,132,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,130,
+  2,0,2,0,2,0,2,137,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,132,0,2,0,2,0,2,0,133,2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,130,2,0,130,2,0,2,0,2,133,0,2,0,
+  130,2,0,130,2,0,130,2,0,4,3,0,2,0,2,132,0,2,0,2,0,131,2,0,2,130,0,2,130,0,2,0,130,2,0,4,3,0,2,0,130,2,0,2,0,2,0,2,0,131,2,0,130,2,0,130,2,0,2,0,130,2,0,4,
+  3,0,2,0,2,0,2,0,130,2,0,2,0,131,2,130,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,0,2,0,2,0,130,2,0,133,2,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,
+  0,2,0,2,0,2,0,2,0,131,2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,0,2,0,2,0,2,0,2,133,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,0,2,
+  0,2,0,2,0,2,2,0,132,2,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,0,2,0,2,0,2,131,0,2,132,0,2,0,2,0,2,0,2,0,2,0,2,0,4,3,0,2,0,2,0,130,2,0,131,2,
+  0,2,0,130,2,0,130,2,0,2,0,130,2,0,2,0,4,3,0,2,0,2,135,0,2,0,2,0,130,2,132,0,2,132,0,2,0,4,3,0,2,0,137,2,0,2,0,140,2,0,2,0,4,0,0,2,139,0,2,140,0,2,0,2,
+  0,0,0,140,2,0,142,2,0,2,2,0,0,2,2,137,0,2,144,0,2,2,0,132,0,131,5,0,5,0,0,2,0,0,140,2,132,0,6,6,0,133,5,0,5,5,0,148,2,6,6,0,130,5,0,132,5,132,0,2,143,0
+};
+
+// Bee Afraid, Bee Very Afraid
+static constexpr struct spawnpoint sg_level4spawns[] = {
+  {0,1},{1,1},{2,1},{4,1},{5,1},{6,1},{28,1},{17,2},{18,2},{19,2},{20,2},{21,2},{0,4},{2,4},{7,4},{8,4},
+  {9,4},{10,4},{11,4},{12,4},{13,4},{14,4},{15,4},{16,4},{17,4},{21,4},{22,4},{33,4},{34,4},{35,4},{23,5},{24,5},
+  {25,5},{26,5},{27,5},{28,5},{29,5},{30,5},{31,5},{32,5},{0,6},{1,6},{2,6},{3,6},{4,6},{5,6},{6,6},{10,7},
+  {11,7},{12,7},{13,7},{14,7},{15,7},{16,7},{17,7},{18,7},{19,7},{20,7},{21,7},{22,7},{23,7},{24,7},{25,7},{26,7},
+  {27,7},{28,7},{29,7},{30,7},{31,7},{32,7},{33,7},{0,10},{1,10},{2,10},{3,10},{4,10},{5,10},{6,10},{7,10},{9,10},
+  {10,10},{11,10},{12,10},{13,10},{14,10},{15,10},{16,10},{17,10},{18,10},{19,10},{20,10},{21,10},{22,10},{23,10},{24,10},{25,10},
+  {26,10},{27,10},{28,10},{29,10},{30,10},{31,10},{32,10},{33,10},{34,10},{35,10}
+};
+static constexpr uint8_t sg_level4regions[] = {
+  163,0,163,1,130,0,1,130,0,148,1,0,134,1,131,1,0,1,0,137,1,132,0,141,1,131,1,0,1,0,156,1,0,1,0,0,130,1,138,0,130,1,0,0,137,1,130,0,139,1,0,133,1,0,130,1,137,0,130,1,134,0,1,1,
+  0,151,1,0,1,131,1,0,130,1,154,0,1,163,1,163,1,163,0
+};
+
+// Plan Bee
+static constexpr struct spawnpoint sg_level5spawns[] = {
+  {0,6},{1,6},{2,6},{3,6},{7,6},{8,6},{12,6},{13,6},{14,6},{15,6},{16,6},{17,6},{18,6},{19,6},{0,11},{19,15},
+  {2,18},{3,18},{4,18},{5,18},{6,18},{7,18},{8,18},{9,18},{10,18},{11,18},{13,18},{14,18},{15,18},{16,18},{17,18},{18,18},
+  {19,18},{0,20},{1,21},{2,21},{3,21},{4,21},{5,21},{6,21},{7,21},{8,21},{9,21},{10,21},{11,21},{12,21},{13,21},{14,21},
+  {16,21},{17,21},{18,21},{19,21},{0,36},{1,36},{2,36},{3,36},{4,36},{5,36},{6,36},{7,36},{8,36},{9,36},{10,36},{11,36},
+  {12,36},{13,36},{15,37},{16,37},{17,37},{18,37},{19,37},{0,39},{1,39},{6,39},{7,39},{8,39},{9,39},{10,39},{11,39},{12,39},
+  {13,39},{14,39},{18,39},{10,45},{0,51},{15,51},{16,51},{18,51},{19,51},{1,54},{2,54},{3,54},{4,54},{5,54},{6,54},{8,54},
+  {9,54},{10,54},{11,54},{12,54},{13,54},{14,54},{0,56},{15,56},{3,58},{12,58},{19,58},{15,59},{16,59},{0,62},{1,62},{2,62},
+  {3,62},{4,62},{5,62},{6,62},{7,62},{8,62},{9,62},{10,62},{11,62},{12,62},{13,62},{14,62},{15,62},{16,62},{18,62},{19,62},
+  {19,65},{2,68},{8,68},{14,68},{15,68},{16,68},{19,68}
+};
+static constexpr uint8_t sg_level5regions[] = {
+  147,0,133,1,0,130,1,0,130,1,0,132,1,1,133,0,1,0,1,0,1,0,1,130,0,1,0,0,135,1,0,130,1,0,134,1,142,0,1,131,0,147,1,147,1,131,0,130,1,0,0,130,1,135,0,147,1,132,1,0,131,1,0,135,
+  1,0,130,1,0,131,1,0,132,1,0,132,1,147,1,0,146,1,130,1,0,137,1,0,132,1,132,1,0,141,1,135,1,0,138,1,130,1,0,133,1,0,135,1,0,141,1,0,132,1,147,1,1,1,145,0,147,1,0,146,1,1,141,0,
+  1,131,0,147,1,131,1,143,0,0,0,145,1,130,1,139,0,1,0,1,0,0,130,1,0,143,1,131,0,1,139,0,1,0,0,147,1,1,141,0,130,1,0,0,138,1,0,135,1,136,0,1,1,133,0,1,0,0,147,1,1,143,0,1,
+  0,0,147,1,147,1,141,0,133,1,142,1,132,0,142,1,0,131,1,0,0,131,1,137,0,1,1,0,1,1,0,0,144,1,137,1,0,0,1,131,0,1,0,1,132,1,0,132,1,0,1,0,133,1,138,1,0,1,0,1,0,0,1,0,
+  0,135,1,0,1,1,0,1,0,133,1,137,1,0,0,1,0,0,1,0,1,0,0,138,1,0,1,0,133,1,138,1,0,1,0,1,0,0,1,0,1,139,0,1,130,0,131,1,1,1,0,137,1,0,1,0,131,1,1,1,0,130,1,135,
+  0,133,1,0,1,130,0,137,1,0,0,1,0,0,0,130,1,135,0,130,1,0,131,1,0,141,1,0,131,1,134,0,1,135,0,131,1,146,1,0,0,132,1,0,1,0,133,1,0,131,1,147,1,130,1,0,135,1,0,133,1,0,133,1,
+  0,135,1,0,0,130,1,135,1,0,138,1,147,1,144,0,1,0,0,145,1,0,2,145,1,0,2,0,144,1,0,0,145,1,0,3,145,1,0,3,1,1,0,132,1,0,132,1,130,0,1,1,0
+};
+
+// Zombee Apocalypse
+static constexpr struct spawnpoint sg_level6spawns[] = {
+  {28,0},{29,0},{30,0},{67,1},{68,1},{69,1},{70,2},{71,2},{8,3},{9,3},{10,3},{23,3},{24,3},{25,3},{34,3},{35,3},
+  {36,3},{40,3},{41,3},{42,3},{62,3},{63,3},{64,3},{73,3},{74,3},{75,3},{46,5},{47,5},{48,5},{57,5},{58,5},{59,5},
+  {3,6},{4,6},{5,6},{12,6},{13,6},{14,6},{18,6},{19,6},{20,6},{70,7},{71,7},{72,7},{52,8},{53,8},{54,8},{6,10},
+  {7,10},{10,10},{11,10},{15,10},{16,10},{21,10},{22,10},{26,10},{27,10},{31,10},{32,10},{37,10},{38,10},{43,10},{44,10},{49,10},
+  {50,10},{60,10},{61,10},{65,10},{66,10},{70,10},{71,10},{72,10},{73,10},{74,10}
+};
+static constexpr uint8_t sg_level6regions[] = {
+  201,1,0,1,155,1,130,0,140,1,0,134,1,130,0,148,1,155,1,130,0,163,1,130,0,133,1,178,1,0,142,1,0,1,130,0,131,1,135,1,130,0,139,1,130,0,135,1,130,0,130,1,130,0,146,1,130,0,135,1,130,0,135,1,
+  0,1,0,139,1,0,1,0,135,1,0,1,0,130,1,0,1,0,146,1,0,1,0,135,1,0,1,0,173,1,130,0,135,1,130,0,143,1,130,1,130,0,133,1,130,0,130,1,130,0,152,1,0,1,0,135,1,0,1,0,143,1,130,1,
+  0,1,0,133,1,0,1,0,130,1,0,1,0,176,1,130,0,130,1,179,1,130,0,148,1,179,1,0,1,0,148,1,133,1,0,0,1,1,0,0,130,1,0,0,131,1,0,0,130,1,0,0,130,1,0,0,131,1,0,0,131,1,0,0,
+  131,1,0,0,136,1,0,0,130,1,0,0,130,1,132,0,1
+};
+
+// Bee Kind
+static constexpr struct spawnpoint sg_level7spawns[] = {
+  {0,0},{1,0},{2,0},{3,0},{4,0},{5,0},{39,1},{2,4},{7,4},{31,4},{32,4},{34,4},{27,5},{38,5},{39,5},{1,7},
+  {2,7},{3,7},{4,8},{5,8},{36,8},{37,8},{38,8},{39,8},{6,9},{7,9},{8,9},{15,10},{21,10},{22,10},{23,10},{24,10},
+  {25,10},{26,10},{27,10},{28,10},{29,10},{30,10},{31,10},{35,10},{36,10},{37,10},{38,10},{39,10}
+};
+static constexpr uint8_t sg_level7regions[] = {
+  167,1,133,0,161,1,136,1,0,156,1,0,136,1,0,157,1,136,1,0,132,1,0,132,1,0,145,1,1,1,0,131,1,0,1,0,148,1,0,0,1,0,132,1,136,1,0,144,1,0,131,1,0,1,0,130,1,0,0,136,1,0,149,1,
+  0,1,0,132,1,1,130,0,132,1,0,147,1,0,1,0,1,0,132,1,131,1,0,0,130,1,0,149,1,0,1,0,1,131,0,133,1,131,0,149,1,0,1,0,132,1,135,1,0,0,132,1,0,132,1,139,0,1,133,0
+};
+
+static constexpr struct leveldata sg_leveldata[] =
+{
+  { sg_level1spawns, 73, sg_level1regions, 80 },
+  { sg_level2spawns, 100, sg_level2regions, 149 },
+  { sg_level3spawns, 48, sg_level3regions, 638 },
+  { sg_level4spawns, 106, sg_level4regions, 83 },
+  { sg_level5spawns, 135, sg_level5regions, 437 },
+  { sg_level6spawns, 74, sg_level6regions, 209 },
+  { sg_level7spawns, 44, sg_level7regions, 124 }
+};
+
+#endif // ! defined GUARD_BEEKIND_GENERATED_LEVELPREP_H
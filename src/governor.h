@@ -0,0 +1,105 @@
+//=============================================================================
+//	FILE:					governor.h
+//	SYSTEM:
+//	DESCRIPTION:	Frame budget governor, sheds cosmetic work while frames run over
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_GOVERNOR_H
+#define GUARD_BEEKIND_GOVERNOR_H
+
+#include <cstdint>
+
+// Shed levels, each sheds its own work as well as that of the levels before it
+#define SHEDNONE 0 // Everything runs
+#define SHEDPARTICLES 1 // Fewer particles, no invulnerability trail
+#define SHEDPARALLAX 2 // No parallax
+#define SHEDDEBUG 3 // Debug overlays cut down to the shed level
+#define SHEDAI 4 // Agents away from the view decide half as often
+#define SHEDMAX SHEDAI
+
+#define GOVERNOROVER 4 // Frames in a row over budget before shedding another level
+#define GOVERNORUNDER 60 // Frames in a row with headroom before restoring a level
+#define GOVERNORHEADROOM 60 // Percentage of the budget a frame must come in under to have headroom
+
+// Short names for the overlay
+static const char * const sg_shednames[SHEDMAX+1] =
+{
+	"NONE", "PART", "PRLX", "DBUG", "AI"
+};
+
+struct governor
+{
+	bool enabled; // Shed work when over budget, otherwise stays at SHEDNONE
+	uint32_t budget; // Time to update and draw a frame in (us)
+	uint8_t level; // Current shed level
+	uint8_t peak; // Highest shed level reached
+	uint32_t over; // Frames in a row over budget
+	uint32_t under; // Frames in a row with headroom
+	uint64_t shed; // Frames run with something shed
+};
+
+// Start governing against a budget (us), or stop shedding when not enabled
+inline void
+governor_reset(struct governor & gov, const bool enabled, const uint32_t budget)
+{
+	gov.enabled=enabled;
+	gov.budget=budget;
+	gov.level=SHEDNONE;
+	gov.peak=SHEDNONE;
+	gov.over=0;
+	gov.under=0;
+	gov.shed=0;
+}
+
+// Check if work at a shed level is being shed
+inline bool
+governor_sheds(const struct governor & gov, const uint8_t level)
+{
+	return (gov.level>=level);
+}
+
+// Take the time of the last frame (us), shedding a level after a run of frames over budget, and
+// restoring one after a longer run with headroom, so it doesn't flip between levels
+inline void
+governor_endframe(struct governor & gov, const uint32_t frame)
+{
+	if (!gov.enabled)
+		return;
+
+	if (gov.level!=SHEDNONE)
+		gov.shed++;
+
+	if (frame>gov.budget)
+	{
+		gov.under=0;
+
+		if ((++gov.over>=GOVERNOROVER) && (gov.level<SHEDMAX))
+		{
+			gov.level++;
+			gov.over=0;
+
+			if (gov.level>gov.peak)
+				gov.peak=gov.level;
+		}
+	}
+	else
+	if (frame<((gov.budget*GOVERNORHEADROOM)/100))
+	{
+		gov.over=0;
+
+		if ((++gov.under>=GOVERNORUNDER) && (gov.level>SHEDNONE))
+		{
+			gov.level--;
+			gov.under=0;
+		}
+	}
+	else
+	{
+		gov.over=0;
+		gov.under=0;
+	}
+}
+
+#endif // ! defined GUARD_BEEKIND_GOVERNOR_H
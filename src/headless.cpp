@@ -0,0 +1,757 @@
+//=============================================================================
+//	FILE:					headless.cpp
+//	SYSTEM:
+//	DESCRIPTION:	SDK-free host which drives the game from scripted input
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "platform.h"
+#include "game.h"
+#include "replay.h"
+#include "levelgen.h"
+#include "levelpack.h"
+#include "rle.h"
+#include "workpool.h"
+
+// A scripted input step, holds a set of inputs for a number of frames
+struct scriptstep
+{
+	uint32_t frames; // Number of frames to hold inputs for
+	uint32_t inputs; // Bitmask of pressed inputs (1<<platform_input)
+};
+
+// Default script, run right, jump, shoot and run back again
+static const std::vector<struct scriptstep> sg_defaultscript =
+{
+	{ 60, (1<<INPUT_PLAYER1_RIGHT) },
+	{ 10, (1<<INPUT_PLAYER1_RIGHT) | (1<<INPUT_PLAYER1_UP) },
+	{ 30, (1<<INPUT_PLAYER1_RIGHT) | (1<<INPUT_PLAYER1_BUTTON1) },
+	{ 20, 0 },
+	{ 60, (1<<INPUT_PLAYER1_LEFT) },
+	{ 10, (1<<INPUT_PLAYER1_LEFT) | (1<<INPUT_PLAYER1_UP) },
+	{ 30, (1<<INPUT_PLAYER1_LEFT) | (1<<INPUT_PLAYER1_BUTTON1) },
+	{ 20, (1<<INPUT_PLAYER1_DOWN) }
+};
+
+// A game being simulated
+struct instance
+{
+	struct gamestate gs; // Game state
+	uint32_t step; // Current script step
+	uint32_t held; // Frames the current step has been held for
+	uint64_t frames; // Frames run
+	FILE *csv; // Per frame time against entity counts, NULL when not logging
+	struct workpool pool; // Workers deciding AI for this game
+};
+
+// Count heap allocations against the game running on this thread
+void *
+operator new(std::size_t size)
+{
+	void *p=malloc((size>0)?size:1);
+
+	if (p==NULL)
+		throw std::bad_alloc();
+
+	counter_add(COUNTER_ALLOCS);
+
+	return p;
+}
+
+void
+operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+	free(p);
+}
+
+// Inputs pressed for the current frame, per thread as each thread runs its own games
+static thread_local uint32_t sg_inputs=0;
+
+uint32_t
+platform_inputs()
+{
+	return sg_inputs;
+}
+
+uint64_t
+platform_clock()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Nothing is drawn when headless
+void
+platform_set_colour(const uint8_t, const uint8_t, const uint8_t, const uint8_t)
+{
+}
+
+void
+platform_clear()
+{
+}
+
+void
+platform_solid_rectangle(const int32_t, const int32_t, const int32_t, const int32_t)
+{
+}
+
+void
+platform_image(const int32_t, const int32_t, const uint8_t, const bool)
+{
+}
+
+// Load an input script, one step per line as "<frames> [UP|DOWN|LEFT|RIGHT|FIRE|DIPSW1 ...]"
+static bool
+loadscript(const char *filename, std::vector<struct scriptstep> & script)
+{
+	FILE *fp=fopen(filename, "r");
+	char line[256];
+
+	if (fp==NULL)
+		return false;
+
+	script.clear();
+
+	while (fgets(line, sizeof(line), fp)!=NULL)
+	{
+		struct scriptstep step;
+		char *token=strtok(line, " \t\r\n");
+
+		// Skip blank lines and comments
+		if ((token==NULL) || (token[0]=='#'))
+			continue;
+
+		step.frames=atoi(token);
+		step.inputs=0;
+
+		while ((token=strtok(NULL, " \t\r\n"))!=NULL)
+		{
+			if (strcmp(token, "UP")==0) step.inputs|=(1<<INPUT_PLAYER1_UP);
+			else if (strcmp(token, "DOWN")==0) step.inputs|=(1<<INPUT_PLAYER1_DOWN);
+			else if (strcmp(token, "LEFT")==0) step.inputs|=(1<<INPUT_PLAYER1_LEFT);
+			else if (strcmp(token, "RIGHT")==0) step.inputs|=(1<<INPUT_PLAYER1_RIGHT);
+			else if (strcmp(token, "FIRE")==0) step.inputs|=(1<<INPUT_PLAYER1_BUTTON1);
+			else if (strcmp(token, "DIPSW1")==0) step.inputs|=(1<<INPUT_DIPSW1);
+			else
+				fprintf(stderr, "Unknown input '%s' in %s\n", token, filename);
+		}
+
+		if (step.frames>0)
+			script.push_back(step);
+	}
+
+	fclose(fp);
+
+	return (script.size()>0);
+}
+
+// Parse stress populations as "bees,zombees,grubs,plants"
+static bool
+parsestress(const char *arg, struct stressconfig & stress)
+{
+	unsigned int bees, zombees, grubs, plants;
+
+	if (sscanf(arg, "%u,%u,%u,%u", &bees, &zombees, &grubs, &plants)!=4)
+		return false;
+
+	stress.bees=bees;
+	stress.zombees=zombees;
+	stress.grubs=grubs;
+	stress.plants=plants;
+
+	return true;
+}
+
+// Parse AI scheduling as "buckets,budget"
+static bool
+parseai(const char *arg, struct aiconfig & ai)
+{
+	unsigned int buckets, budget;
+
+	if (sscanf(arg, "%u,%u", &buckets, &budget)!=2)
+		return false;
+
+	ai.buckets=buckets;
+	ai.budget=budget;
+
+	return true;
+}
+
+// Parse generated level size as "WxH"
+static bool
+parsesize(const char *arg, uint16_t & width, uint16_t & height)
+{
+	unsigned int w, h;
+
+	if ((sscanf(arg, "%ux%u", &w, &h)!=2) || (w<GENMINWIDTH) || (h<GENMINHEIGHT) || (w>UINT16_MAX) || (h>UINT16_MAX) || (((uint64_t)w*h)>INT32_MAX))
+		return false;
+
+	width=w;
+	height=h;
+
+	return true;
+}
+
+// Generate a level and use it as the level pack, so it's played after the built in levels. Its layers are
+// RLE packed, so big levels are streamed a chunk at a time as they're played
+static bool
+generatelevel(struct levelpack & pack, const uint16_t width, const uint16_t height, const uint64_t seed)
+{
+	std::vector<uint8_t> tiles, chars, data;
+	char title[64];
+
+	levelgen_generate(width, height, seed, tiles, chars);
+	snprintf(title, sizeof(title), "GENERATED %ux%u", width, height);
+
+	auto packlayer=[](std::vector<uint8_t> & layer)
+	{
+		std::vector<uint8_t> packed(rle_encode(layer.data(), layer.size(), nullptr));
+
+		rle_encode(layer.data(), layer.size(), packed.data());
+		layer.swap(packed);
+	};
+
+	packlayer(tiles);
+	packlayer(chars);
+
+	const struct level lvl=
+	{
+		.width = width,
+		.height = height,
+		.title = title,
+		.tiles = tiles.data(),
+		.chars = chars.data(),
+		.tilessize = (uint32_t)tiles.size(),
+		.charssize = (uint32_t)chars.size(),
+		.packed = true
+	};
+
+	levelpack_build(&lvl, 1, data);
+
+	return levelpack_use(pack, std::move(data));
+}
+
+// Write the levels of the pack in use out as a pack file, or the built in levels when there isn't one
+static bool
+savelevels(const struct levelpack & pack, const char *filename)
+{
+	if (pack.data==NULL)
+		return levelpack_save(levels, NUMLEVELS, filename);
+
+	std::vector<struct level> packlevels;
+
+	for (uint16_t n=0; n<pack.count; n++)
+		packlevels.push_back(levelpack_level(pack, n));
+
+	return levelpack_save(packlevels.data(), pack.count, filename);
+}
+
+// Log last frame time against entity counts
+static void
+logframe(const struct instance & game)
+{
+	const struct gamestate & gs=game.gs;
+	uint32_t bees=0, zombees=0, grubs=0, plants=0;
+
+	for (uint32_t i=0; i<gs.chars.size(); i++)
+	{
+		switch (gs.chars[i].id)
+		{
+			case 51: case 52: bees++; break;
+			case 53: case 54: zombees++; break;
+			case 55: case 56: grubs++; break;
+			case 30: case 31: case 32: case 33: plants++; break;
+			default: break;
+		}
+	}
+
+	fprintf(game.csv, "%llu,%zu,%u,%u,%u,%u,%u,%u,%u,%.3f,%.3f\n", (unsigned long long)game.frames, gs.chars.size(), bees, zombees, grubs, plants, gs.particles.count,
+		profile_last(gs.prof, PHASE_UPDATE), profile_last(gs.prof, PHASE_DRAW), (double)gs.x, (double)gs.y);
+}
+
+// Run a game for a number of frames, or until its replay runs out
+static void
+rungame(struct instance & game, const std::vector<struct scriptstep> & script, const uint64_t frames, const bool replaying)
+{
+	for (game.frames=0; game.frames<frames; game.frames++)
+	{
+		// Stop when the replay runs out
+		if ((replaying) && (!game_replaying(game.gs)))
+			break;
+
+		// Move script onwards, looping at the end
+		if (game.held>=script[game.step].frames)
+		{
+			game.step=(game.step+1)%script.size();
+			game.held=0;
+		}
+		game.held++;
+
+		sg_inputs=script[game.step].inputs;
+
+		game_update(game.gs);
+		game_draw(game.gs);
+
+		if (game.csv!=NULL)
+			logframe(game);
+	}
+}
+
+// Read whole file into data
+static bool
+readfile(const char *filename, std::vector<uint8_t> & data)
+{
+	FILE *fp=fopen(filename, "rb");
+	uint8_t buffer[1024];
+	size_t len;
+
+	if (fp==NULL)
+		return false;
+
+	data.clear();
+	while ((len=fread(buffer, 1, sizeof(buffer), fp))>0)
+		data.insert(data.end(), buffer, buffer+len);
+
+	fclose(fp);
+
+	return true;
+}
+
+// Write data out to file
+static bool
+writefile(const char *filename, const std::vector<uint8_t> & data)
+{
+	FILE *fp=fopen(filename, "wb");
+
+	if (fp==NULL)
+		return false;
+
+	bool ok=((data.size()==0) || (fwrite(data.data(), data.size(), 1, fp)==1));
+
+	fclose(fp);
+
+	return ok;
+}
+
+static void
+usage(const char *name)
+{
+	printf("Usage: %s [-f frames] [-l level] [-r seed] [-s script] [-i state] [-o state] [-T trace] [-S stress] [-A ai] [-B budget] [-c csv] [-L pack | -G WxH] [-P pack] [-g games] [-t threads] [-j workers] [-w replay | -p replay]\n", name);
+	printf("  -f frames  Number of frames to run (default 100000)\n");
+	printf("  -g games   Number of independent games to run, each seeded from seed+n (default 1)\n");
+	printf("  -t threads Number of threads to run games on (default all cores)\n");
+	printf("  -j workers Number of workers deciding AI for each game (default the cores left over by -t)\n");
+	printf("  -l level   Start playing at level (1 based) instead of the intro\n");
+	printf("  -r seed    Seed for random numbers (default 0)\n");
+	printf("  -s script  Input script file, lines of \"<frames> [UP|DOWN|LEFT|RIGHT|FIRE|DIPSW1 ...]\"\n");
+	printf("  -i state   Start from a saved snapshot\n");
+	printf("  -o state   Save a snapshot of the (first) game at the end\n");
+	printf("  -T trace   Write Chrome trace JSON of the (first) game, needs BEEKIND_TRACE\n");
+	printf("  -S stress  Add \"bees,zombees,grubs,plants\" to each level, lifting population caps\n");
+	printf("  -A ai      Schedule agents away from the view as \"buckets,budget\", deciding once every buckets updates, at most budget per update (0 for defaults)\n");
+	printf("  -B budget  Shed cosmetic work (and then far AI decisions) while frames take longer than budget us, 0 for one frame at 30fps\n");
+	printf("  -c csv     Log frame time (us) against entity counts and player position of the (first) game, each frame\n");
+	printf("  -L pack    Add levels from level pack file after the built in ones\n");
+	printf("  -G WxH     Generate a level of WxH tiles from the seed, played after the built in levels\n");
+	printf("  -P pack    Write the levels from -L or -G (or else the built in ones) out as a level pack file and exit\n");
+	printf("  -w replay  Record inputs to replay file\n");
+	printf("  -p replay  Play back inputs from replay file, until it ends or frames run out\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	uint64_t frames=100000;
+	int level=0;
+	uint64_t seed=0;
+	uint32_t numgames=1;
+	uint32_t numthreads=std::thread::hardware_concurrency();
+	uint32_t numworkers=0;
+	std::vector<struct scriptstep> script=sg_defaultscript;
+	const char *recordfile=NULL;
+	const char *playfile=NULL;
+	const char *loadfile=NULL;
+	const char *savefile=NULL;
+	const char *tracefile=NULL;
+	const char *csvfile=NULL;
+	const char *packfile=NULL;
+	const char *savepackfile=NULL;
+	uint16_t genwidth=0, genheight=0;
+	struct levelpack pack={};
+	struct stressconfig stress={};
+	struct aiconfig ai={};
+	bool governed=false;
+	uint32_t budget=0;
+	struct tracebuffer trace;
+	struct replay rec;
+	std::vector<uint8_t> snapshot;
+
+	for (int i=1; i<argc; i++)
+	{
+		if ((strcmp(argv[i], "-f")==0) && ((i+1)<argc))
+			frames=strtoull(argv[++i], NULL, 10);
+		else
+		if ((strcmp(argv[i], "-l")==0) && ((i+1)<argc))
+			level=atoi(argv[++i]);
+		else
+		if ((strcmp(argv[i], "-r")==0) && ((i+1)<argc))
+			seed=strtoull(argv[++i], NULL, 10);
+		else
+		if ((strcmp(argv[i], "-g")==0) && ((i+1)<argc))
+			numgames=atoi(argv[++i]);
+		else
+		if ((strcmp(argv[i], "-t")==0) && ((i+1)<argc))
+			numthreads=atoi(argv[++i]);
+		else
+		if ((strcmp(argv[i], "-j")==0) && ((i+1)<argc))
+			numworkers=atoi(argv[++i]);
+		else
+		if ((strcmp(argv[i], "-s")==0) && ((i+1)<argc))
+		{
+			if (!loadscript(argv[++i], script))
+			{
+				fprintf(stderr, "Unable to load script %s\n", argv[i]);
+				return 1;
+			}
+		}
+		else
+		if ((strcmp(argv[i], "-i")==0) && ((i+1)<argc))
+			loadfile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-o")==0) && ((i+1)<argc))
+			savefile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-T")==0) && ((i+1)<argc))
+			tracefile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-S")==0) && ((i+1)<argc))
+		{
+			if (!parsestress(argv[++i], stress))
+			{
+				fprintf(stderr, "Stress populations should be bees,zombees,grubs,plants\n");
+				return 1;
+			}
+		}
+		else
+		if ((strcmp(argv[i], "-A")==0) && ((i+1)<argc))
+		{
+			if (!parseai(argv[++i], ai))
+			{
+				fprintf(stderr, "AI scheduling should be buckets,budget\n");
+				return 1;
+			}
+		}
+		else
+		if ((strcmp(argv[i], "-B")==0) && ((i+1)<argc))
+		{
+			governed=true;
+			budget=strtoul(argv[++i], NULL, 10);
+		}
+		else
+		if ((strcmp(argv[i], "-c")==0) && ((i+1)<argc))
+			csvfile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-L")==0) && ((i+1)<argc))
+			packfile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-G")==0) && ((i+1)<argc))
+		{
+			if (!parsesize(argv[++i], genwidth, genheight))
+			{
+				fprintf(stderr, "Generated level size should be WxH, at least %ux%u\n", GENMINWIDTH, GENMINHEIGHT);
+				return 1;
+			}
+		}
+		else
+		if ((strcmp(argv[i], "-P")==0) && ((i+1)<argc))
+			savepackfile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-w")==0) && ((i+1)<argc))
+			recordfile=argv[++i];
+		else
+		if ((strcmp(argv[i], "-p")==0) && ((i+1)<argc))
+			playfile=argv[++i];
+		else
+		{
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (numgames<1) numgames=1;
+	if (numthreads<1) numthreads=1;
+	if (numthreads>numgames) numthreads=numgames;
+	if (numworkers<1) numworkers=std::max<uint32_t>(std::thread::hardware_concurrency()/numthreads, 1);
+
+	// Replays are for a single game
+	if (((recordfile!=NULL) || (playfile!=NULL)) && (numgames>1))
+	{
+		fprintf(stderr, "Replays can only be used with a single game\n");
+		return 1;
+	}
+
+	// Generated levels take the place of a level pack
+	if ((packfile!=NULL) && (genwidth>0))
+	{
+		fprintf(stderr, "A level pack and a generated level can't be used together\n");
+		return 1;
+	}
+
+	if ((packfile!=NULL) && (!levelpack_open(pack, packfile)))
+	{
+		fprintf(stderr, "Unable to load level pack %s\n", packfile);
+		return 1;
+	}
+
+	if ((genwidth>0) && (!generatelevel(pack, genwidth, genheight, seed)))
+	{
+		fprintf(stderr, "Unable to generate level\n");
+		return 1;
+	}
+
+	if (savepackfile!=NULL)
+	{
+		if (!savelevels(pack, savepackfile))
+		{
+			fprintf(stderr, "Unable to save level pack %s\n", savepackfile);
+			return 1;
+		}
+
+		return 0;
+	}
+
+#if !defined(BEEKIND_TRACE)
+	if (tracefile!=NULL)
+	{
+		fprintf(stderr, "Tracing needs a build with BEEKIND_TRACE enabled\n");
+		return 1;
+	}
+#endif
+
+	if (loadfile!=NULL)
+	{
+		if (!readfile(loadfile, snapshot))
+		{
+			fprintf(stderr, "Unable to load snapshot %s\n", loadfile);
+			return 1;
+		}
+	}
+
+	std::vector<struct instance> games(numgames);
+
+	for (uint32_t n=0; n<numgames; n++)
+	{
+		struct gamestate & gs=games[n].gs;
+
+		game_seed(gs, seed+n);
+		game_stress(gs, stress);
+		game_aischedule(gs, ai);
+		game_governor(gs, governed, budget);
+		game_levelpack(gs, (pack.data!=NULL)?&pack:NULL);
+
+		if (playfile!=NULL)
+		{
+			if (!replay_load(rec, playfile))
+			{
+				fprintf(stderr, "Unable to load replay %s\n", playfile);
+				return 1;
+			}
+
+			game_playback(gs, rec);
+		}
+		else
+		if (recordfile!=NULL)
+			game_record(gs, rec, level);
+		else
+		if (level>0)
+			game_start(gs, level-1);
+		else
+			game_initialise(gs);
+
+		if ((loadfile!=NULL) && (!game_restore(gs, snapshot.data(), snapshot.size())))
+		{
+			fprintf(stderr, "Invalid snapshot %s\n", loadfile);
+			return 1;
+		}
+	}
+
+	if (tracefile!=NULL)
+	{
+		trace_reset(trace, 1<<20, platform_clock);
+		games[0].gs.trace=&trace;
+	}
+
+	if (csvfile!=NULL)
+	{
+		if ((games[0].csv=fopen(csvfile, "w"))==NULL)
+		{
+			fprintf(stderr, "Unable to write %s\n", csvfile);
+			return 1;
+		}
+
+		fprintf(games[0].csv, "frame,chars,bees,zombees,grubs,plants,particles,update_us,draw_us,player_x,player_y\n");
+	}
+
+	if (numworkers>1)
+	{
+		for (uint32_t n=0; n<numgames; n++)
+		{
+			workpool_start(games[n].pool, numworkers);
+			game_workpool(games[n].gs, &games[n].pool);
+		}
+	}
+
+	auto start=std::chrono::steady_clock::now();
+
+	// Share games out between threads
+	std::vector<std::thread> threads;
+
+	for (uint32_t t=0; t<numthreads; t++)
+	{
+		threads.emplace_back([&, t]()
+		{
+			for (uint32_t n=t; n<numgames; n+=numthreads)
+				rungame(games[n], script, frames, (playfile!=NULL));
+		});
+	}
+
+	for (uint32_t t=0; t<numthreads; t++)
+		threads[t].join();
+
+	std::chrono::duration<double> elapsed=std::chrono::steady_clock::now()-start;
+
+	if (numworkers>1)
+		for (uint32_t n=0; n<numgames; n++)
+			workpool_stop(games[n].pool);
+
+	if (games[0].csv!=NULL)
+		fclose(games[0].csv);
+
+	if ((tracefile!=NULL) && (!trace_write(trace, tracefile)))
+		fprintf(stderr, "Unable to write trace %s\n", tracefile);
+
+	if (recordfile!=NULL)
+	{
+		game_stopreplay(games[0].gs);
+
+		if (!replay_save(rec, recordfile))
+			fprintf(stderr, "Unable to save replay %s\n", recordfile);
+	}
+
+	uint64_t totalframes=0;
+	uint32_t checksum=0; // Games combined in order, so any of them differing shows (one game gives its own)
+
+	for (uint32_t n=0; n<numgames; n++)
+	{
+		totalframes+=games[n].frames;
+		checksum=(checksum*16777619u)^game_checksum(games[n].gs);
+	}
+
+	printf("games         : %u on %u threads, %u AI workers each\n", numgames, numthreads, numworkers);
+	printf("frames        : %llu\n", (unsigned long long)totalframes);
+	printf("updates       : %llu\n", (unsigned long long)(totalframes*UPDATES_PER_FRAME));
+	printf("elapsed       : %.3f s\n", elapsed.count());
+	if (elapsed.count()>0)
+		printf("updates/s     : %.0f\n", (totalframes*UPDATES_PER_FRAME)/elapsed.count());
+	printf("checksum      : %08x\n", checksum);
+	printf("ai budget     : %u far decisions per update, %u per frame\n", game_aibudget(games[0].gs), game_aibudget(games[0].gs)*UPDATES_PER_FRAME);
+	if (governed)
+	{
+		const struct governor & gov=games[0].gs.gov;
+
+		printf("governor      : %u us budget, shed level %u (%s) peak %u, %llu frames shed\n", gov.budget, gov.level, sg_shednames[gov.level], gov.peak, (unsigned long long)gov.shed);
+	}
+
+	// Frame profile of the first game, over its last frames
+	printf("phase         :   min   avg   p99 (us, last %u frames)\n", games[0].gs.prof.count);
+	for (int i=0; i<PHASE_COUNT; i++)
+	{
+		struct profilestats stats=profile_stats(games[0].gs.prof, (profilephase)i);
+
+		printf("  %-12s: %5u %5u %5u\n", sg_phasenames[i], stats.min, stats.avg, stats.p99);
+	}
+
+	// Counters of the first game
+	printf("counter       :   last    avg   peak (per frame, last %u of %llu frames)\n", games[0].gs.count.count, (unsigned long long)games[0].gs.count.frames);
+	for (int i=0; i<COUNTER_COUNT; i++)
+		printf("  %-12s: %6u %6u %6u\n", sg_counternames[i], games[0].gs.count.last[i], counter_average(games[0].gs.count, (countertype)i), counter_peak(games[0].gs.count, (countertype)i));
+
+	// Paths planned by the agents of the first game still about, to check retargeting
+	{
+		uint32_t agents=0;
+		uint64_t replans=0;
+		uint32_t most=0;
+
+		for (uint32_t id=0; id<games[0].gs.chars.size(); id++)
+		{
+			const struct gamechar & c=games[0].gs.chars[id];
+
+			if ((c.id<51) || (c.id>56))
+				continue;
+
+			agents++;
+			replans+=c.replans;
+			most=std::max(most, c.replans);
+		}
+
+		printf("replans       : %llu by %u agents, most %u by one\n", (unsigned long long)replans, agents, most);
+	}
+
+	// Time snapshots of the first game, restoring each into a fresh instance
+	{
+		const int loops=1000;
+		std::vector<uint8_t> check;
+		struct gamestate fresh={};
+		bool ok=true;
+
+		game_levelpack(fresh, games[0].gs.pack);
+
+		auto t0=std::chrono::steady_clock::now();
+		for (int n=0; n<loops; n++)
+			game_save(games[0].gs, snapshot);
+		auto t1=std::chrono::steady_clock::now();
+		for (int n=0; n<loops; n++)
+			ok&=game_restore(fresh, snapshot.data(), snapshot.size());
+		auto t2=std::chrono::steady_clock::now();
+
+		game_save(fresh, check);
+		ok&=((check==snapshot) && (game_checksum(fresh)==game_checksum(games[0].gs)));
+
+		// A game on the intro has no map loaded, so check it round trips too
+		struct gamestate intro={};
+		std::vector<uint8_t> introsnapshot;
+
+		game_levelpack(intro, games[0].gs.pack);
+		game_initialise(intro);
+		game_save(intro, introsnapshot);
+		ok&=game_restore(fresh, introsnapshot.data(), introsnapshot.size());
+		game_save(fresh, check);
+		ok&=((check==introsnapshot) && (game_checksum(fresh)==game_checksum(intro)));
+
+		std::chrono::duration<double, std::micro> savetime=t1-t0;
+		std::chrono::duration<double, std::micro> restoretime=t2-t1;
+
+		printf("snapshot      : %zu bytes, save %.2f us, restore %.2f us%s\n", snapshot.size(), savetime.count()/loops, restoretime.count()/loops, ok?"":" MISMATCH");
+
+		if ((savefile!=NULL) && (!writefile(savefile, snapshot)))
+			fprintf(stderr, "Unable to save snapshot %s\n", savefile);
+	}
+
+	return 0;
+}
@@ -0,0 +1,259 @@
+//=============================================================================
+//	FILE:					leveldata.h
+//	SYSTEM:
+//	DESCRIPTION:	Data derived from level layouts, shared by levelprep and the game
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_LEVELDATA_H
+#define GUARD_BEEKIND_LEVELDATA_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "rle.h"
+
+// Spawn point
+struct spawnpoint
+{
+	float x; // x position
+	float y; // y position
+};
+
+// Derived data of a level
+struct leveldata
+{
+	const struct spawnpoint *spawns; // Empty tiles above a flat edge, which things can be spawned onto
+	uint32_t numspawns; // Number of spawn points
+	const uint8_t *regions; // Connected area each tile is in, 0 when solid (areas may share a number past 255), RLE packed
+	uint32_t regionssize; // Packed size of regions
+};
+
+// Check if tile is a flat edge which things can stand on
+constexpr bool
+leveldata_isflatedge(const uint8_t tile)
+{
+	switch (tile-1)
+	{
+		case 3:
+		case 4:
+		case 5:
+		case 6:
+		case 7:
+		case 8:
+		case 9:
+		case 19:
+		case 20:
+		case 21:
+		case 22:
+		case 27:
+		case 28:
+			return true;
+
+		default:
+			break;
+	}
+
+	return false;
+}
+
+// Find spawn points of a level, row(y) gives the tiles of a row (only needing to stay valid until the next call)
+template<typename ROW>
+inline void
+leveldata_spawns(const ROW & row, const uint32_t width, const uint32_t height, std::vector<struct spawnpoint> & spawns)
+{
+	std::vector<uint8_t> above(width);
+
+	spawns.clear();
+
+	if (height==0)
+		return;
+
+	memcpy(above.data(), row(0), width);
+
+	for (uint32_t y=1; y<height; y++)
+	{
+		const uint8_t *tiles=row(y);
+
+		for (uint32_t x=0; x<width; x++)
+		{
+			if ((leveldata_isflatedge(tiles[x])) && (above[x]<=1))
+				spawns.push_back({(float)x, (float)(y-1)});
+		}
+
+		memcpy(above.data(), tiles, width);
+	}
+}
+
+// Number the connected areas of empty tiles, as the pathfinder moves through them, into an RLE packed layer.
+// Runs of empty tiles take the area of those they touch in the row above, so only two rows are held at a time.
+// A run touching nothing above starts an area, and only these starts are kept, to join those which meet further
+// down. Areas are numbered in the order their first tile comes, row by row, as a flood fill from each tile would
+template<typename ROW>
+inline void
+leveldata_regions(const ROW & row, const uint32_t width, const uint32_t height, std::vector<uint8_t> & regions)
+{
+	struct run
+	{
+		uint32_t start; // First tile
+		uint32_t end; // Tile after the last
+		uint32_t area; // Start of the area it's in
+	};
+
+	std::vector<uint32_t> parent; // Start each start was joined to, the first start of an area is its root
+	std::vector<struct run> above;
+	std::vector<struct run> runs;
+	std::vector<uint8_t> line(width);
+	uint32_t starts=0;
+
+	auto find=[&](uint32_t area)
+	{
+		while (parent[area]!=area)
+		{
+			parent[area]=parent[parent[area]];
+			area=parent[area];
+		}
+
+		return area;
+	};
+
+	// Find the runs of a row and the area of each, joining the areas of runs above which it touches when joining
+	auto scan=[&](const uint32_t y, const bool join)
+	{
+		const uint8_t *tiles=row(y);
+		uint32_t first=0; // First run above which may still touch
+
+		runs.clear();
+
+		for (uint32_t x=0; x<width; x++)
+		{
+			if (tiles[x]!=0)
+				continue;
+
+			struct run r={x, x, 0};
+
+			while ((r.end<width) && (tiles[r.end]==0))
+				r.end++;
+
+			x=r.end;
+
+			while ((first<above.size()) && (above[first].end<=r.start))
+				first++;
+
+			if ((first<above.size()) && (above[first].start<r.end))
+			{
+				r.area=above[first].area;
+
+				if (join)
+				{
+					for (uint32_t a=first+1; (a<above.size()) && (above[a].start<r.end); a++)
+					{
+						uint32_t ra=find(r.area);
+						uint32_t rb=find(above[a].area);
+
+						parent[std::max(ra, rb)]=std::min(ra, rb);
+					}
+
+					r.area=find(r.area);
+				}
+			}
+			else
+			{
+				r.area=starts++;
+
+				if (join)
+					parent.push_back(r.area);
+			}
+
+			runs.push_back(r);
+		}
+
+		std::swap(above, runs);
+	};
+
+	// Join the areas
+	for (uint32_t y=0; y<height; y++)
+		scan(y, true);
+
+	// Number the areas, a byte for each start is all that's kept from here
+	std::vector<uint8_t> numbers(starts);
+	uint8_t region=0;
+
+	for (uint32_t area=0; area<starts; area++)
+	{
+		uint32_t root=find(area);
+
+		if (root==area)
+		{
+			region=(region%255)+1;
+			numbers[area]=region;
+		}
+		else
+			numbers[area]=numbers[root];
+	}
+
+	std::vector<uint32_t>().swap(parent);
+
+	// Find the same runs again to write out their numbers a row at a time, each run's area now being one of its
+	// area's starts, which all have the same number
+	regions.clear();
+	above.clear();
+	starts=0;
+
+	for (uint32_t y=0; y<height; y++)
+	{
+		scan(y, false);
+
+		memset(line.data(), 0, width);
+		for (const struct run & r : above)
+			memset(line.data()+r.start, numbers[r.area], r.end-r.start);
+
+		size_t pos=regions.size();
+
+		regions.resize(pos+rle_encode(line.data(), width, nullptr));
+		rle_encode(line.data(), width, regions.data()+pos);
+	}
+}
+
+// FNV-1a hash of the level sizes and unpacked tiles, to spot derived data being stale
+template<typename L>
+constexpr uint32_t
+leveldata_hash(const L *levels, const uint32_t count)
+{
+	uint32_t hash=2166136261u;
+
+	auto add=[&](const uint8_t value)
+	{
+		hash^=value;
+		hash*=16777619u;
+	};
+
+	for (uint32_t n=0; n<count; n++)
+	{
+		const L & lvl=levels[n];
+
+		add(lvl.width&0xff); add(lvl.width>>8);
+		add(lvl.height&0xff); add(lvl.height>>8);
+
+		for (uint32_t i=0; i<lvl.tilessize; i++)
+		{
+			uint8_t code=lvl.tiles[i];
+
+			if ((lvl.packed) && (code&0x80))
+			{
+				uint8_t value=lvl.tiles[++i];
+
+				for (uint32_t c=(code&0x7f)+1; c>0; c--)
+					add(value);
+			}
+			else
+				add(code);
+		}
+	}
+
+	return hash;
+}
+
+#endif // ! defined GUARD_BEEKIND_LEVELDATA_H
@@ -0,0 +1,200 @@
+//=============================================================================
+//	FILE:					levelgen.h
+//	SYSTEM:
+//	DESCRIPTION:	Seeded procedural level generator, for benchmark and soak runs
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_LEVELGEN_H
+#define GUARD_BEEKIND_LEVELGEN_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "leveldata.h"
+#include "random.h"
+
+// Tile values as held in level layers (tile id+1)
+#define GENEDGELEFT 4 // Flat edge, left end
+#define GENEDGE 5 // Flat edge
+#define GENEDGERIGHT 6 // Flat edge, right end
+#define GENWALL 40 // Solid block, for maze walls
+
+// Char values as held in level layers (tile id+1)
+#define GENPLAYER 46
+#define GENHIVE 37
+#define GENFLOWER 34
+#define GENTOADSTOOL 32
+#define GENGRUB 56
+#define GENBEE 52
+
+#define GENMINWIDTH 20 // Smallest level, the size of the screen
+#define GENMINHEIGHT 12
+
+#define GENMAZECELLS 6 // Maze size in cells along each side
+#define GENMAZESIZE ((GENMAZECELLS*2)+1) // Maze size in tiles along each side
+
+// Random number in the range 0 <= n < range
+inline uint32_t
+levelgen_rand(struct rngstate & state, const uint32_t range)
+{
+	return (uint32_t)(((uint64_t)rng_next(state)*range)>>32);
+}
+
+// Carve a maze with its top left corner at x,y, walls are solid with a gap out of each side
+inline void
+levelgen_maze(struct rngstate & state, std::vector<uint8_t> & tiles, const uint32_t width, const uint32_t x, const uint32_t y)
+{
+	std::vector<uint8_t> visited(GENMAZECELLS*GENMAZECELLS, 0);
+	std::vector<uint32_t> stack;
+
+	for (uint32_t my=0; my<GENMAZESIZE; my++)
+		for (uint32_t mx=0; mx<GENMAZESIZE; mx++)
+			tiles[((y+my)*width)+x+mx]=GENWALL;
+
+	auto open=[&](const uint32_t cx, const uint32_t cy)
+	{
+		tiles[((y+(cy*2)+1)*width)+x+(cx*2)+1]=0;
+	};
+
+	// Depth first walk of the cells, knocking through walls as it goes
+	stack.push_back(0);
+	visited[0]=1;
+	open(0, 0);
+
+	while (stack.size()>0)
+	{
+		uint32_t cell=stack.back();
+		uint32_t cx=cell%GENMAZECELLS;
+		uint32_t cy=cell/GENMAZECELLS;
+		uint32_t next[4];
+		uint32_t count=0;
+
+		if ((cy>0) && (!visited[cell-GENMAZECELLS])) next[count++]=cell-GENMAZECELLS;
+		if ((cx<(GENMAZECELLS-1)) && (!visited[cell+1])) next[count++]=cell+1;
+		if ((cy<(GENMAZECELLS-1)) && (!visited[cell+GENMAZECELLS])) next[count++]=cell+GENMAZECELLS;
+		if ((cx>0) && (!visited[cell-1])) next[count++]=cell-1;
+
+		if (count==0)
+		{
+			stack.pop_back();
+			continue;
+		}
+
+		uint32_t n=next[levelgen_rand(state, count)];
+		uint32_t nx=n%GENMAZECELLS;
+		uint32_t ny=n/GENMAZECELLS;
+
+		// Wall between the two cells
+		tiles[((y+cy+ny+1)*width)+x+cx+nx+1]=0;
+
+		visited[n]=1;
+		open(nx, ny);
+		stack.push_back(n);
+	}
+
+	// Ways in and out at the middle of each side
+	tiles[((y+GENMAZECELLS)*width)+x]=0;
+	tiles[((y+GENMAZECELLS)*width)+x+GENMAZESIZE-1]=0;
+	tiles[(y*width)+x+GENMAZECELLS]=0;
+	tiles[((y+GENMAZESIZE-1)*width)+x+GENMAZECELLS]=0;
+}
+
+// Generate a level of width x height tiles (at least GENMINWIDTH x GENMINHEIGHT), the same seed always gives the same level
+inline void
+levelgen_generate(const uint16_t width, const uint16_t height, const uint64_t seed, std::vector<uint8_t> & tiles, std::vector<uint8_t> & chars)
+{
+	struct rngstate state;
+	std::vector<uint8_t> used((size_t)width*height, 0); // Tiles taken by mazes
+	std::vector<struct spawnpoint> spawns;
+
+	rng_seed(state, seed, 0);
+
+	tiles.assign((size_t)width*height, 0);
+	chars.assign((size_t)width*height, 0);
+
+	// Floor along the bottom
+	for (uint32_t x=0; x<width; x++)
+		tiles[((size_t)(height-1)*width)+x]=GENEDGE;
+
+	// Scatter mazes over big enough levels, roughly one per 64x32 tiles
+	if ((width>(GENMAZESIZE+4)) && (height>(GENMAZESIZE+8)))
+	{
+		uint32_t mazes=((uint32_t)width*height)/(64*32);
+
+		for (uint32_t i=0; i<mazes; i++)
+		{
+			uint32_t x=2+levelgen_rand(state, width-GENMAZESIZE-4);
+			uint32_t y=2+levelgen_rand(state, height-GENMAZESIZE-8);
+			bool clear=true;
+
+			// Keep a tile of space around each maze
+			for (uint32_t my=y-1; (clear) && (my<=(y+GENMAZESIZE)); my++)
+				for (uint32_t mx=x-1; (clear) && (mx<=(x+GENMAZESIZE)); mx++)
+					clear=(used[(my*width)+mx]==0);
+
+			if (!clear)
+				continue;
+
+			for (uint32_t my=y-1; my<=(y+GENMAZESIZE); my++)
+				for (uint32_t mx=x-1; mx<=(x+GENMAZESIZE); mx++)
+					used[(my*width)+mx]=1;
+
+			levelgen_maze(state, tiles, width, x, y);
+		}
+	}
+
+	// Platforms every 4 to 6 rows, made of runs of flat edges with gaps to jump through
+	for (int32_t y=height-1-(4+levelgen_rand(state, 3)); y>=3; y-=(4+levelgen_rand(state, 3)))
+	{
+		uint32_t x=levelgen_rand(state, 4);
+
+		while (x<width)
+		{
+			uint32_t len=3+levelgen_rand(state, 10);
+
+			for (uint32_t i=0; (i<len) && ((x+i)<width); i++)
+			{
+				if ((used[(y*width)+x+i]) || (used[((y-1)*width)+x+i]))
+					continue;
+
+				tiles[(y*width)+x+i]=(i==0)?GENEDGELEFT:((i==(len-1))?GENEDGERIGHT:GENEDGE);
+			}
+
+			x+=len+2+levelgen_rand(state, 6);
+		}
+	}
+
+	// Player starts on the floor at the left
+	chars[((size_t)(height-2)*width)+std::min<uint32_t>(2, width-1)]=GENPLAYER;
+
+	// Everything else goes on free flat edges
+	leveldata_spawns([&](const uint32_t y) { return tiles.data()+((size_t)y*width); }, width, height, spawns);
+
+	auto place=[&](const uint8_t value, const uint32_t count)
+	{
+		for (uint32_t i=0; (i<count) && (spawns.size()>0); i++)
+		{
+			uint32_t n=levelgen_rand(state, spawns.size());
+			size_t index=((size_t)(uint32_t)spawns[n].y*width)+(uint32_t)spawns[n].x;
+
+			if (chars[index]==0)
+				chars[index]=value;
+
+			spawns[n]=spawns.back();
+			spawns.pop_back();
+		}
+	};
+
+	uint32_t area=(uint32_t)width*height;
+
+	place(GENHIVE, std::max<uint32_t>(1, area/800));
+	place(GENFLOWER, std::max<uint32_t>(2, area/150));
+	place(GENTOADSTOOL, std::max<uint32_t>(1, area/500));
+	place(GENGRUB, std::max<uint32_t>(1, area/400));
+	place(GENBEE, std::max<uint32_t>(1, area/600));
+}
+
+#endif // ! defined GUARD_BEEKIND_LEVELGEN_H
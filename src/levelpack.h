@@ -0,0 +1,274 @@
+//=============================================================================
+//	FILE:					levelpack.h
+//	SYSTEM:
+//	DESCRIPTION:	External level pack files, mapped and read in place
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_LEVELPACK_H
+#define GUARD_BEEKIND_LEVELPACK_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "levels.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LEVELPACK_MMAP
+#endif
+
+// Pack file layout, all little endian
+//   header  "BKLP", u16 version, u16 count, u32 index offset
+//   index   count entries of
+//             u16 width, u16 height, u32 title offset,
+//             u32 tiles offset, u32 tiles size, u32 chars offset, u32 chars size, u32 flags
+//   data    NUL terminated titles and layers, at any offsets
+#define LEVELPACKVERSION 1
+#define LEVELPACKHEADER 12
+#define LEVELPACKENTRY 28
+#define LEVELPACKPACKED 1 // flag, layers are RLE packed
+
+// Open level pack
+struct levelpack
+{
+	const uint8_t *data; // Whole file
+	size_t size; // Size of file
+	uint16_t count; // Number of levels
+	uint32_t index; // Offset of index
+	bool mapped; // Data is mapped, otherwise read into buffer
+	std::vector<uint8_t> buffer; // File contents when it can't be mapped
+};
+
+inline uint16_t
+levelpack_u16(const uint8_t *p)
+{
+	return p[0]|(p[1]<<8);
+}
+
+inline uint32_t
+levelpack_u32(const uint8_t *p)
+{
+	return p[0]|(p[1]<<8)|(p[2]<<16)|((uint32_t)p[3]<<24);
+}
+
+// Check a range lies within the pack
+inline bool
+levelpack_within(const struct levelpack & pack, const uint32_t offset, const uint32_t size)
+{
+	return ((offset<=pack.size) && (size<=(pack.size-offset)));
+}
+
+// Get level n from the pack, pointing into the pack data
+inline struct level
+levelpack_level(const struct levelpack & pack, const uint16_t n)
+{
+	const uint8_t *entry=pack.data+pack.index+(n*LEVELPACKENTRY);
+
+	return
+	{
+		.width = levelpack_u16(entry+0),
+		.height = levelpack_u16(entry+2),
+		.title = (const char *)(pack.data+levelpack_u32(entry+4)),
+		.tiles = pack.data+levelpack_u32(entry+8),
+		.chars = pack.data+levelpack_u32(entry+16),
+		.tilessize = levelpack_u32(entry+12),
+		.charssize = levelpack_u32(entry+20),
+		.packed = ((levelpack_u32(entry+24)&LEVELPACKPACKED)!=0)
+	};
+}
+
+// Release pack
+inline void
+levelpack_close(struct levelpack & pack)
+{
+#if defined(LEVELPACK_MMAP)
+	if ((pack.mapped) && (pack.data!=NULL))
+		munmap((void *)pack.data, pack.size);
+#endif
+
+	pack.data=NULL;
+	pack.size=0;
+	pack.count=0;
+	pack.index=0;
+	pack.mapped=false;
+	pack.buffer.clear();
+}
+
+// Check header and index, so levels can be used without further checks
+inline bool
+levelpack_validate(struct levelpack & pack)
+{
+	if ((pack.size<LEVELPACKHEADER) ||
+		(pack.data[0]!='B') || (pack.data[1]!='K') || (pack.data[2]!='L') || (pack.data[3]!='P') ||
+		(levelpack_u16(pack.data+4)!=LEVELPACKVERSION))
+		return false;
+
+	pack.count=levelpack_u16(pack.data+6);
+	pack.index=levelpack_u32(pack.data+8);
+
+	if (!levelpack_within(pack, pack.index, pack.count*LEVELPACKENTRY))
+		return false;
+
+	for (uint16_t n=0; n<pack.count; n++)
+	{
+		const uint8_t *entry=pack.data+pack.index+(n*LEVELPACKENTRY);
+		uint16_t width=levelpack_u16(entry+0);
+		uint16_t height=levelpack_u16(entry+2);
+		uint32_t title=levelpack_u32(entry+4);
+		bool packed=((levelpack_u32(entry+24)&LEVELPACKPACKED)!=0);
+
+		// Tile indices are 32 bit signed
+		if ((width==0) || (height==0) || (((uint64_t)width*height)>INT32_MAX))
+			return false;
+
+		// Title must be terminated within the pack
+		if ((title>=pack.size) || (memchr(pack.data+title, 0, pack.size-title)==NULL))
+			return false;
+
+		// Raw layers must be whole, packed ones are unpacked with bounds checks
+		for (int layer=0; layer<2; layer++)
+		{
+			uint32_t offset=levelpack_u32(entry+8+(layer*8));
+			uint32_t size=levelpack_u32(entry+12+(layer*8));
+
+			if ((!levelpack_within(pack, offset, size)) || ((!packed) && (size!=((uint32_t)width*height))))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Open pack file, mapping it when possible so nothing is copied
+inline bool
+levelpack_open(struct levelpack & pack, const char *filename)
+{
+	levelpack_close(pack);
+
+#if defined(LEVELPACK_MMAP)
+	int fd=open(filename, O_RDONLY);
+	struct stat st;
+
+	if (fd<0)
+		return false;
+
+	if ((fstat(fd, &st)==0) && (st.st_size>0))
+	{
+		void *p=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (p!=MAP_FAILED)
+		{
+			pack.data=(const uint8_t *)p;
+			pack.size=st.st_size;
+			pack.mapped=true;
+		}
+	}
+
+	close(fd);
+#endif
+
+	if (!pack.mapped)
+	{
+		FILE *fp=fopen(filename, "rb");
+		uint8_t buffer[1024];
+		size_t len;
+
+		if (fp==NULL)
+			return false;
+
+		while ((len=fread(buffer, 1, sizeof(buffer), fp))>0)
+			pack.buffer.insert(pack.buffer.end(), buffer, buffer+len);
+
+		fclose(fp);
+
+		pack.data=pack.buffer.data();
+		pack.size=pack.buffer.size();
+	}
+
+	if (!levelpack_validate(pack))
+	{
+		levelpack_close(pack);
+		return false;
+	}
+
+	return true;
+}
+
+// Use a pack built in memory, taking over its data
+inline bool
+levelpack_use(struct levelpack & pack, std::vector<uint8_t> && data)
+{
+	levelpack_close(pack);
+
+	pack.buffer=std::move(data);
+	pack.data=pack.buffer.data();
+	pack.size=pack.buffer.size();
+
+	if (!levelpack_validate(pack))
+	{
+		levelpack_close(pack);
+		return false;
+	}
+
+	return true;
+}
+
+// Build a pack of levels in memory, layers are stored as they are held
+inline void
+levelpack_build(const struct level *levels, const uint16_t count, std::vector<uint8_t> & data)
+{
+	data.assign(LEVELPACKHEADER+(count*LEVELPACKENTRY), 0);
+
+	auto put16=[&](const size_t pos, const uint16_t value) { data[pos]=value&0xff; data[pos+1]=value>>8; };
+	auto put32=[&](const size_t pos, const uint32_t value) { for (int i=0; i<4; i++) data[pos+i]=(value>>(i*8))&0xff; };
+	auto append=[&](const uint8_t *p, const size_t size) { uint32_t offset=data.size(); data.insert(data.end(), p, p+size); return offset; };
+
+	data[0]='B'; data[1]='K'; data[2]='L'; data[3]='P';
+	put16(4, LEVELPACKVERSION);
+	put16(6, count);
+	put32(8, LEVELPACKHEADER);
+
+	for (uint16_t n=0; n<count; n++)
+	{
+		size_t entry=LEVELPACKHEADER+(n*LEVELPACKENTRY);
+
+		put16(entry+0, levels[n].width);
+		put16(entry+2, levels[n].height);
+		put32(entry+4, append((const uint8_t *)levels[n].title, strlen(levels[n].title)+1));
+		put32(entry+8, append(levels[n].tiles, levels[n].tilessize));
+		put32(entry+12, levels[n].tilessize);
+		put32(entry+16, append(levels[n].chars, levels[n].charssize));
+		put32(entry+20, levels[n].charssize);
+		put32(entry+24, levels[n].packed?LEVELPACKPACKED:0);
+	}
+}
+
+// Write levels out as a pack file
+inline bool
+levelpack_save(const struct level *levels, const uint16_t count, const char *filename)
+{
+	std::vector<uint8_t> data;
+
+	levelpack_build(levels, count, data);
+
+	FILE *fp=fopen(filename, "wb");
+
+	if (fp==NULL)
+		return false;
+
+	bool ok=(fwrite(data.data(), data.size(), 1, fp)==1);
+
+	fclose(fp);
+
+	return ok;
+}
+
+#endif // ! defined GUARD_BEEKIND_LEVELPACK_H
@@ -0,0 +1,112 @@
+//=============================================================================
+//	FILE:					levelprep.cpp
+//	SYSTEM:
+//	DESCRIPTION:	Offline level preprocessor, writes derived data of the built in levels
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#include <cstdio>
+#include <vector>
+#include "levels.h"
+#include "leveldata.h"
+#include "rle.h"
+
+// Write a byte array, wrapping lines to keep the output readable
+static void
+writebytes(FILE *fp, const char *name, const std::vector<uint8_t> & data)
+{
+	fprintf(fp, "static constexpr uint8_t %s[] = {", name);
+
+	for (size_t i=0; i<data.size(); i++)
+		fprintf(fp, "%s%s%u", (i>0)?",":"", ((i%64)==0)?"\n  ":"", data[i]);
+
+	fprintf(fp, "\n};\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	std::vector<uint8_t> tiles;
+	std::vector<struct spawnpoint> spawns;
+	std::vector<uint8_t> regions;
+	std::vector<size_t> numspawns;
+	std::vector<size_t> regionssizes;
+	char name[64];
+
+	if (argc!=2)
+	{
+		printf("Usage: %s output.h\n", argv[0]);
+		return 1;
+	}
+
+	FILE *fp=fopen(argv[1], "w");
+
+	if (fp==NULL)
+	{
+		fprintf(stderr, "Unable to write %s\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(fp, "//=============================================================================\n");
+	fprintf(fp, "//\tFILE:\t\t\t\t\tlevelprep.h\n");
+	fprintf(fp, "//\tSYSTEM:\n");
+	fprintf(fp, "//\tDESCRIPTION:\tDerived level data, generated by levelprep from levels.h, do not edit\n");
+	fprintf(fp, "//=============================================================================\n\n");
+	fprintf(fp, "#ifndef GUARD_BEEKIND_GENERATED_LEVELPREP_H\n");
+	fprintf(fp, "#define GUARD_BEEKIND_GENERATED_LEVELPREP_H\n\n");
+	fprintf(fp, "#include \"leveldata.h\"\n\n");
+	fprintf(fp, "#define LEVELPREP_HASH 0x%08xu\n\n", leveldata_hash(levels, NUMLEVELS));
+
+	for (uint32_t n=0; n<NUMLEVELS; n++)
+	{
+		const struct level & lvl=levels[n];
+
+		tiles.resize((size_t)lvl.width*lvl.height);
+		if (lvl.packed)
+			rle_unpack(lvl.tiles, lvl.tilessize, tiles.data(), tiles.size());
+		else
+			tiles.assign(lvl.tiles, lvl.tiles+tiles.size());
+
+		auto row=[&](const uint32_t y) { return tiles.data()+((size_t)y*lvl.width); };
+
+		leveldata_spawns(row, lvl.width, lvl.height, spawns);
+		leveldata_regions(row, lvl.width, lvl.height, regions);
+
+		fprintf(fp, "// %s\n", lvl.title);
+
+		if (spawns.size()>0)
+		{
+			fprintf(fp, "static constexpr struct spawnpoint sg_level%uspawns[] = {", n+1);
+			for (size_t i=0; i<spawns.size(); i++)
+				fprintf(fp, "%s%s{%d,%d}", (i>0)?",":"", ((i%16)==0)?"\n  ":"", (int)spawns[i].x, (int)spawns[i].y);
+			fprintf(fp, "\n};\n");
+		}
+
+		snprintf(name, sizeof(name), "sg_level%uregions", n+1);
+		writebytes(fp, name, regions);
+		fprintf(fp, "\n");
+
+		numspawns.push_back(spawns.size());
+		regionssizes.push_back(regions.size());
+	}
+
+	fprintf(fp, "static constexpr struct leveldata sg_leveldata[] =\n{\n");
+	for (uint32_t n=0; n<NUMLEVELS; n++)
+	{
+		if (numspawns[n]>0)
+			fprintf(fp, "  { sg_level%uspawns, %zu, sg_level%uregions, %zu }%s\n", n+1, numspawns[n], n+1, regionssizes[n], ((n+1)<NUMLEVELS)?",":"");
+		else
+			fprintf(fp, "  { nullptr, 0, sg_level%uregions, %zu }%s\n", n+1, regionssizes[n], ((n+1)<NUMLEVELS)?",":"");
+	}
+	fprintf(fp, "};\n\n");
+
+	fprintf(fp, "#endif // ! defined GUARD_BEEKIND_GENERATED_LEVELPREP_H\n");
+
+	bool ok=(ferror(fp)==0);
+
+	fclose(fp);
+
+	return ok?0:1;
+}
@@ -1,68 +1,166 @@
+//=============================================================================
+//	FILE:					levels.h
+//	SYSTEM:
+//	DESCRIPTION:	Level layouts, held in constant tables so they stay in ROM
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_LEVELS_H
+#define GUARD_BEEKIND_LEVELS_H
+
+#include <cstdint>
+#include "rle.h"
+
+// Level, tiles and chars layers unpack to width*height bytes
 struct level
 {
-  const uint8_t width;
-  const uint8_t height;
-  const std::string title;
-  const std::vector<uint8_t> tiles;
-  const std::vector<uint8_t> chars;
+  const uint16_t width;
+  const uint16_t height;
+  const char *title;
+  const uint8_t *tiles;
+  const uint8_t *chars;
+  const uint32_t tilessize; // Bytes in tiles layer
+  const uint32_t charssize; // Bytes in chars layer
+  const bool packed; // Layers are RLE packed
 };
 
-const std::vector<level> levels = 
+// Bee Keeper Bunny
+static constexpr uint8_t sg_level1tiles[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,4,8,6,0,0,0,0,0,0,0,10,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,14,0,16,0,0,7,21,23,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,14,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,7,5,5,8,5,8,5,5,23,5,8,8,6,25,5,5,5,5,5,5,26,0,0,4,23,5,5,23,21,5,8,5,5,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,5,8,5,5,21,8,5,5,5,5,5,22,5,8,5,5,5,5,5,22,8,5,5,5,5,5,5,8,5,5,5,29,0};
+static constexpr uint8_t sg_level1chars[] = {0,0,0,0,0,0,20,0,0,0,0,0,0,52,0,0,0,0,0,0,35,36,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,53,0,0,0,0,0,0,0,4,5,6,0,0,0,0,0,20,0,0,25,26,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,4,6,52,14,0,16,0,0,0,0,0,30,0,0,0,0,0,0,54,0,0,0,46,0,0,0,0,0,48,0,0,34,0,0,0,0,14,27,5,26,0,16,0,27,26,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,35,59,57,0,0,0,0,0,0,17,0,0,0,0,19,0,0,0,0,40,0,0,0,0,0,0,48,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,49,0,0,50,0,0,0,17,51,19,0,0,0,25,26,19,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,32,60,0,57,0,58,33,0,59,35,0,32,0,0,56,0,36,0,0,0,0,0,0,36,0,0,37,0,37,57,0,35,0,0,0,0,21,0,0,0,0,0,22,0,23,0,0,21,0,0,0,0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,36,0,56,0,0,0,0,57,0,0,0,33,36,35,57,56,0,0,0,0,0,0,35,33,0,37,0,0,56,0,32,19,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,22,0,21,0,0,0,0,0,0,0,0,21,23,0,0,0,0,0,0,0,0};
+
+// Bee Whizz
+static constexpr uint8_t sg_level2tiles[] = {59,58,60,59,59,59,59,58,59,59,59,59,59,59,59,58,59,58,59,60,59,59,59,60,59,59,59,58,59,59,59,58,59,59,58,60,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,8,22,22,5,5,21,5,8,6,0,0,28,8,5,22,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,14,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,22,5,5,8,6,0,0,0,0,0,0,0,4,23,0,0,0,0,0,14,0,39,0,0,0,0,0,0,16,0,0,0,4,6,0,0,0,0,0,0,0,8,5,5,5,8,22,5,26,0,0,0,0,10,0,0,39,0,39,0,0,0,0,0,0,5,5,5,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,7,5,5,21,5,8,5,23,5,5,5,22,6,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,19,0,17,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,18,19,0,39,0,39,0,0,4,8,5,5,5,22,6,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,16,0,0,16,0,7,21,22,8,5,5,22,23,22,5,8,5,22,8,21,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,16,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,10,0,0,0,0,0,0,0,0,25,9,0,0,0,0,0,4,21,22,8,5,5,22,21,5,5,8,5,5,5,29,0,0,28,22,21,8,29,0,0,0,0,0,0,0,0,27,5,8,6};
+static constexpr uint8_t sg_level2chars[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,54,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,52,0,53,0,0,0,33,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,1,0,27,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,49,0,0,0,0,0,0,27,0,0,0,26,0,0,0,31,0,0,33,0,56,0,0,0,0,56,0,31,1,0,0,0,0,0,0,49,49,49,0,0,0,0,0,0,0,0,46,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,40,49,0,0,10,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,53,0,0,0,51,0,0,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,35,0,59,59,59,0,0,0,35,0,33,0,24,0,0,0,48,0,40,0,0,0,20,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,10,0,0,59,0,49,0,0,0,30,0,20,0,32,0,53,0,0,0,17,0,11,33,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,17,0,0,30,0,20,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,30,0,0,0,0,0};
+
+// Bee Amazed
+static constexpr uint8_t sg_level3tiles[] = {39,39,39,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,39,39,39,40,0,0,58,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,60,0,0,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,58,39,0,39,39,39,39,39,39,39,0,39,0,0,0,0,0,0,50,0,39,39,39,39,39,39,39,39,39,39,39,0,39,60,0,49,0,40,0,0,0,0,0,0,0,49,0,0,0,0,0,0,48,0,40,0,0,0,0,0,0,0,0,0,40,0,40,0,0,40,0,49,0,0,39,39,39,39,39,58,39,39,39,39,39,39,60,0,40,0,39,39,39,39,39,39,39,0,49,0,49,0,0,49,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,40,0,0,0,0,0,40,0,48,0,40,0,0,50,0,49,39,39,39,39,39,39,39,39,0,39,0,0,35,35,36,35,60,0,49,36,35,35,39,0,49,0,49,0,49,0,0,49,0,40,0,0,0,49,0,0,0,49,0,49,0,0,0,0,0,0,0,0,40,0,0,0,50,0,40,0,50,0,49,0,0,48,0,49,0,0,0,48,0,39,0,48,0,58,39,39,39,39,39,39,39,39,49,0,39,0,39,0,49,0,49,0,50,0,0,49,0,58,0,0,0,49,0,40,0,49,0,0,0,0,40,0,0,0,0,0,40,0,48,0,48,0,50,0,40,0,49,0,0,60,0,0,0,39,0,39,0,49,0,40,39,39,39,39,59,39,39,35,39,0,49,0,50,0,39,0,48,0,49,0,49,0,0,39,39,39,39,40,0,59,0,40,0,49,0,0,0,0,0,0,39,0,48,0,58,0,48,0,60,0,49,0,59,0,48,0,0,49,0,0,0,40,0,0,0,49,0,49,0,39,28,5,5,29,49,0,50,0,0,0,50,0,0,0,48,0,0,0,49,0,0,40,0,39,0,58,39,39,39,40,0,50,0,49,0,0,0,0,49,0,58,39,39,0,58,35,39,0,49,0,0,0,49,0,0,39,0,48,0,0,0,39,0,60,0,49,0,49,0,0,0,0,49,0,0,0,50,0,0,0,40,0,50,0,0,0,49,0,0,40,0,50,0,39,0,50,0,0,0,58,0,49,0,0,0,0,58,39,39,0,48,0,39,0,49,0,49,0,39,0,50,0,0,39,0,48,0,48,0,39,0,39,0,0,0,49,0,0,0,0,0,0,48,0,50,0,40,0,40,0,40,0,50,0,49,0,0,40,0,50,0,49,0,48,0,40,0,39,0,49,0,0,0,0,39,0,50,0,48,0,50,0,49,0,49,0,49,0,49,0,0,39,0,48,0,40,0,39,0,39,0,49,0,58,38,37,38,37,60,0,48,0,50,0,48,0,40,0,49,0,40,0,49,0,0,40,0,50,0,49,0,50,0,40,0,39,0,0,39,0,0,0,0,0,50,0,48,0,40,0,49,0,48,0,49,0,48,0,0,39,0,48,0,50,0,58,0,39,0,58,39,39,40,0,39,39,39,39,48,0,60,0,50,0,40,0,60,0,48,0,49,0,0,40,0,50,0,49,0,0,0,40,0,0,0,0,49,0,50,0,0,0,50,0,0,0,48,0,49,0,0,0,59,0,40,0,0,39,0,48,0,58,35,36,35,59,35,36,35,0,40,0,48,0,0,0,58,36,35,36,60,0,58,36,35,36,39,0,49,0,0,40,0,50,0,0,0,0,0,0,0,0,0,0,49,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,49,0,39,60,0,58,39,39,39,39,39,39,39,39,39,39,40,0,58,39,39,39,39,39,39,39,39,39,39,39,39,0,50,0,58,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,40,40,0,0,39,7,21,22,23,8,22,21,9,39,0,39,7,21,23,22,21,8,23,8,21,22,8,23,22,21,9,50,0,0,39,58,39,39,60,17,0,0,0,0,35,0,19,40,0,58,17,0,0,0,0,0,0,0,0,0,0,0,0,0,19,58,39,39,60,0,0,35,0,0,0,0,0,0,10,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,10,0,0,0,0,0,59,28,5,8,29,0,28,8,22,23,8,5,5,5,8,21,5,5,22,23,8,29};
+static constexpr uint8_t sg_level3chars[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,33,32,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,0,52,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,46,37,37,0,0,0,56,0,34,0,0,56,0,0,33,0,56,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+
+// Bee Afraid, Bee Very Afraid
+static constexpr uint8_t sg_level4tiles[] = {28,5,22,8,21,5,22,8,23,5,23,5,29,39,10,39,28,21,23,22,5,8,5,5,22,23,21,5,5,21,8,23,29,39,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,4,8,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,14,0,16,0,0,0,0,0,0,0,0,0,0,28,21,22,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,10,39,0,0,0,5,21,23,22,5,5,22,22,23,8,6,0,0,0,4,6,0,0,0,0,0,0,0,0,0,0,4,8,29,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,39,0,0,0,5,5,21,8,5,5,21,5,5,5,0,0,0,4,23,21,23,8,22,6,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,39,0,0,0,39,28,5,5,22,23,5,5,8,5,5,22,5,21,23,22,5,5,5,5,5,8,5,22,21,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,22,5,5,23,22,21,29,59,28,22,5,5,5,22,5,5,5,23,22,5,5,22,5,5,5,5,23,22,5,5,22,5,5,23,29};
+static constexpr uint8_t sg_level4chars[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,25,26,0,48,0,49,0,0,0,0,0,0,0,0,25,26,0,0,51,0,0,0,0,40,0,54,0,0,0,1,0,0,0,0,0,0,0,0,0,40,0,40,0,0,36,35,36,0,0,0,0,0,0,54,0,55,0,0,0,40,0,0,17,52,19,11,17,0,0,0,0,53,0,0,0,49,0,50,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,33,56,37,0,34,33,59,33,59,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,59,33,56,0,0,0,0,17,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,33,33,34,56,34,33,34,0,34,0,0,0,0,0,0,59,0,56,0,0,0,0,52,0,0,0,0,0,0,19,0,0,0,17,25,0,0,0,0,0,0,0,0,0,0,26,0,53,0,0,0,0,0,0,0,0,0,0,36,33,58,34,33,34,33,34,33,60,35,36,37,36,35,33,34,33,34,33,0,0,33,36,0,0,17,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,48,0,0,0,0,54,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,54,0,0,0,0,0,0,57,56,0,57,59,56,0,0,49,57,0,31,31,33,36,31,0,31,0,0,34,33,31,31,0,0,36,31,0,0,33,31,31,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+
+// Plan Bee
+static constexpr uint8_t sg_level5tiles[] = {35,35,35,35,35,35,35,35,35,35,35,35,35,36,39,35,35,35,35,35,0,0,0,0,0,0,35,0,0,0,35,0,0,0,40,0,0,0,0,0,0,36,35,35,35,35,35,0,39,0,35,0,39,0,59,35,35,0,35,35,0,0,0,0,0,0,0,0,40,0,0,0,40,0,0,0,0,0,0,0,35,35,35,35,35,35,35,35,59,35,35,35,59,35,36,0,35,35,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,21,9,0,0,0,7,9,0,0,0,7,5,21,23,22,5,8,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,39,0,0,0,0,0,0,0,0,39,0,0,0,39,0,0,0,0,39,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,5,5,5,5,5,5,5,29,39,28,5,22,5,5,5,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,21,8,5,5,22,21,8,5,23,5,5,5,29,0,28,22,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,36,36,35,35,35,35,35,35,35,35,35,35,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,35,35,35,36,35,35,35,35,35,35,36,0,36,0,35,35,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,35,35,59,0,36,35,35,35,35,36,36,35,35,35,35,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,35,35,36,35,35,35,39,35,35,36,0,0,0,35,35,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,35,35,35,36,36,35,35,35,36,0,0,58,35,35,35,35,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,36,35,35,35,35,36,36,35,35,36,39,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,8,5,23,8,8,23,5,5,8,22,5,21,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,23,21,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,8,9,0,0,0,0,28,8,8,21,5,23,8,23,8,26,0,0,10,0,0,19,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,0,36,35,35,35,0,35,0,0,0,0,0,0,39,0,0,0,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,35,35,0,35,35,0,0,0,0,0,0,0,0,39,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,35,0,35,35,0,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,35,35,0,36,0,36,35,35,35,35,35,35,35,35,35,35,36,0,35,35,36,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,35,0,35,0,0,0,0,0,0,36,0,0,0,35,35,35,35,35,35,35,36,0,0,0,0,0,0,9,0,36,36,36,0,0,0,0,0,0,0,0,0,0,7,22,0,23,5,16,0,0,0,36,35,35,35,35,35,35,36,0,0,0,14,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,27,5,8,23,22,21,6,0,4,5,21,22,23,8,5,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,20,0,0,0,0,0,39,0,39,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,10,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,21,22,23,22,22,21,22,23,22,22,21,23,22,21,23,6,0,7,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,10,0,0,0,0,0,10,0,0,0,0,0,28,8,29,0,0,10};
+static constexpr uint8_t sg_level5chars[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,33,0,0,0,0,0,0,33,0,0,0,0,0,33,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,19,0,0,0,17,19,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,26,0,0,0,0,0,0,0,49,0,0,0,0,49,0,0,0,0,0,0,0,0,50,34,0,0,49,0,48,0,0,49,0,49,0,0,0,50,0,0,0,0,48,0,0,0,49,0,49,0,0,50,0,50,0,0,0,49,0,20,0,0,50,0,0,0,0,0,49,0,0,48,0,49,0,0,0,0,0,30,0,0,48,0,0,0,49,0,0,0,0,49,0,49,0,0,0,49,0,0,0,0,50,0,0,0,49,0,49,0,0,0,0,49,0,0,0,48,0,0,0,0,59,0,0,0,0,0,50,0,0,49,0,0,0,0,0,49,0,0,0,0,0,0,0,0,48,0,49,0,0,49,0,49,0,0,0,0,0,0,0,0,0,0,0,35,59,34,59,36,34,59,36,59,34,0,36,59,37,35,0,34,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,34,0,17,0,0,0,25,26,0,0,0,0,49,0,0,0,0,0,0,0,0,0,57,0,31,0,0,0,0,0,31,0,59,57,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,17,0,0,0,0,0,0,0,0,0,33,0,1,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,56,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,32,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,33,0,0,0,0,33,0,0,0,0,33,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,56,32,0,0,0,0,37,0,0,56,0,0,56,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,1,0,0,0,0,0,0,0,0,0,33,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,6,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,49,0,0,49,0,0,0,0,0,0,0,0,0,0,0,35,0,0,19,0,49,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,49,0,0,49,0,0,0,0,0,0,0,0,35,0,0,0,0,49,0,0,49,0,0,49,0,0,0,0,0,0,0,0,0,0,0,34,33,59,33,34,58,34,33,60,33,34,0,0,0,52,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,33,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,37,0,0,0,0,0,0,0,0,0,0,37,34,0,0,10,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,19,46,17,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,30,0,0,34,0,0,40,0,40,0,0,0,34,0,0,0,0,0,0,59,0,0,0,0,0,0,49,0,49,0,0,0,0,0,0,0,56,0,0,0,0,0,0,53,0,0,0,0,49,0,0,0,30,52,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,57,0,0,60,0,49,0,0,33,56,0,33,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,9,11,4,6,0,4,6,0,4,6,0,4,6,0,16,0,0,0,0,17,16,0,14,16,35,14,16,36,14,16,35,14,16,32,16,0,0,33,0,0,25,5,26,27,5,24,27,5,24,27,5,26,25,29,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,51,0,0,32,0,0,36,0,0,32,0,0,36,35,19,0,0,32,0,0,0,0,0,10,0,0,0,0,0,10,0,0,0,0,0,0,17,0};
+
+// Zombee Apocalypse
+static constexpr uint8_t sg_level6tiles[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,39,39,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,39,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,28,29,0,0,0,0,0,0,0,0,0,0,0,0,7,21,9,0,0,0,0,0,0,0,0,0,0,0,0,7,23,9,0,0,0,0,0,0,0,0,7,23,9,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,23,9,0,0,0,0,0,0,7,8,9,0,0,0,7,21,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,17,0,19,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,28,29,0,0,0,28,29,0,0,0,0,28,29,0,0,0,28,29,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,28,29,0,0,0,28,29,0,0,0,28,22,23,8,29,0};
+static constexpr uint8_t sg_level6chars[] = {6,0,0,0,0,25,26,0,0,0,0,0,0,0,0,16,0,0,14,0,0,0,0,0,0,0,0,0,33,54,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,46,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,55,33,0,0,0,0,49,0,16,33,0,0,0,0,0,0,0,0,0,0,0,0,0,16,33,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,40,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,49,0,27,6,0,0,0,0,0,0,32,56,32,0,0,0,0,27,6,4,26,0,0,0,0,32,56,32,0,0,0,48,0,0,0,0,35,55,33,0,0,0,35,55,35,0,40,0,0,0,0,0,0,0,49,50,49,0,0,0,0,0,0,0,33,55,33,0,0,0,0,0,0,0,0,35,59,35,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,17,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,50,49,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,33,35,33,0,0,0,48,49,40,0,0,33,33,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,56,31,0,0,0,0,0,0,32,56,32,0,0,0,32,56,32,0,0,0,0,0,0,34,0,50,0,0,34,0,0,0,0,0,35,0,0,0,0,0,49,0,0,0,0,0,0,0,49,48,49,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,48,0,0,10,0,0,0,0,0,10,0,0,0,0,0,49,0,0,0,0,0,0,0,40,49,48,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,51,0,0,0,0,39,0,0,0,53,0,0,0,0,0,0,0,0,53,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,59,59,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,59,0,0,0,0,0,33,33,0,0,33,33,0,0,0,36,32,0,0,0,0,33,33,0,0,0,32,37,0,50,0,37,32,0,0,0,0,33,33,0,0,0,0,32,59,0,0,0,0,33,33,0,0,0,0,0,0,0,0,0,37,32,0,0,0,35,35,0,0,0,0,0,0,0,35,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+
+// Bee Kind
+static constexpr uint8_t sg_level7tiles[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,5,5,5,5,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,39,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,10,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,6,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,19,0,30,0,0,0,28,29,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,39,0,0,0,0,0,0,8,22,6,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,40,0,40,0,0,0,0,0,0,0,0,0,5,6,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,40,0,28,5,5,29,0,0,0,0,0,0,5,5,6,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,27,29,0,0,0,0,0,10,0,0,0,0,0,28,5,8,8,5,5,21,22,23,8,29,58,0,60,28,5,5,5,29};
+static constexpr uint8_t sg_level7chars[] = {56,31,31,56,31,31,0,0,0,0,0,0,0,25,26,0,0,0,0,14,0,0,0,0,0,14,0,0,16,33,34,0,0,0,0,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,14,0,0,0,0,0,14,0,0,27,5,6,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,28,26,0,0,0,0,0,14,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,54,33,0,0,0,0,0,33,0,0,0,33,0,0,52,0,0,0,0,17,0,0,0,0,0,36,54,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,40,0,10,0,0,0,40,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,33,0,52,0,49,0,0,0,33,0,49,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,31,31,36,56,0,0,0,0,0,0,0,10,0,0,0,40,0,0,0,10,0,40,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,31,35,0,0,0,0,0,0,0,33,0,49,0,33,0,0,0,49,0,10,0,0,0,0,0,0,0,0,0,0,0,0,31,0,57,31,11,31,0,25,0,0,56,31,31,0,0,0,0,10,0,40,0,10,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,37,33,27,0,0,0,0,0,33,0,0,0,59,0,0,0,33,0,59,56,35,37,31,0,33,0,0,46,31,0,51,0,31,0,31,56,57,0,0,0,28,29,0,0,0,0,0,0,10,0,0,0,0,0,0,0,10,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+
+#if defined(BEEKIND_LEVEL_RLE)
+// Pack layers at compile time, so only the packed data ends up in the binary
+#define LEVELPACK(layer) static constexpr auto layer##rle = rle_pack<rle_packedsize(layer)>(layer)
+#define LEVELLAYER(layer) layer##rle.data()
+#define LEVELSIZE(layer) layer##rle.size()
+#define LEVELPACKED true
+
+LEVELPACK(sg_level1tiles);
+LEVELPACK(sg_level1chars);
+LEVELPACK(sg_level2tiles);
+LEVELPACK(sg_level2chars);
+LEVELPACK(sg_level3tiles);
+LEVELPACK(sg_level3chars);
+LEVELPACK(sg_level4tiles);
+LEVELPACK(sg_level4chars);
+LEVELPACK(sg_level5tiles);
+LEVELPACK(sg_level5chars);
+LEVELPACK(sg_level6tiles);
+LEVELPACK(sg_level6chars);
+LEVELPACK(sg_level7tiles);
+LEVELPACK(sg_level7chars);
+#else
+#define LEVELLAYER(layer) layer
+#define LEVELSIZE(layer) sizeof(layer)
+#define LEVELPACKED false
+#endif
+
+static constexpr struct level levels[] =
 {
   {
     .width = 36,
     .height = 12,
     .title = "Bee Keeper Bunny",
-    .tiles = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,4,8,6,0,0,0,0,0,0,0,10,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,14,0,16,0,0,7,21,23,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,14,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,7,5,5,8,5,8,5,5,23,5,8,8,6,25,5,5,5,5,5,5,26,0,0,4,23,5,5,23,21,5,8,5,5,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,5,8,5,5,21,8,5,5,5,5,5,22,5,8,5,5,5,5,5,22,8,5,5,5,5,5,5,8,5,5,5,29,0},
-    .chars = {0,0,0,0,0,0,20,0,0,0,0,0,0,52,0,0,0,0,0,0,35,36,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,53,0,0,0,0,0,0,0,4,5,6,0,0,0,0,0,20,0,0,25,26,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,4,6,52,14,0,16,0,0,0,0,0,30,0,0,0,0,0,0,54,0,0,0,46,0,0,0,0,0,48,0,0,34,0,0,0,0,14,27,5,26,0,16,0,27,26,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,35,59,57,0,0,0,0,0,0,17,0,0,0,0,19,0,0,0,0,40,0,0,0,0,0,0,48,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,49,0,0,50,0,0,0,17,51,19,0,0,0,25,26,19,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,32,60,0,57,0,58,33,0,59,35,0,32,0,0,56,0,36,0,0,0,0,0,0,36,0,0,37,0,37,57,0,35,0,0,0,0,21,0,0,0,0,0,22,0,23,0,0,21,0,0,0,0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,36,0,56,0,0,0,0,57,0,0,0,33,36,35,57,56,0,0,0,0,0,0,35,33,0,37,0,0,56,0,32,19,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,22,0,21,0,0,0,0,0,0,0,0,21,23,0,0,0,0,0,0,0,0}
+    .tiles = LEVELLAYER(sg_level1tiles),
+    .chars = LEVELLAYER(sg_level1chars),
+    .tilessize = LEVELSIZE(sg_level1tiles),
+    .charssize = LEVELSIZE(sg_level1chars),
+    .packed = LEVELPACKED
   },
 
   {
     .width = 36,
     .height = 13,
     .title = "Bee Whizz",
-    .tiles = {59,58,60,59,59,59,59,58,59,59,59,59,59,59,59,58,59,58,59,60,59,59,59,60,59,59,59,58,59,59,59,58,59,59,58,60,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,8,22,22,5,5,21,5,8,6,0,0,28,8,5,22,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,14,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,22,5,5,8,6,0,0,0,0,0,0,0,4,23,0,0,0,0,0,14,0,39,0,0,0,0,0,0,16,0,0,0,4,6,0,0,0,0,0,0,0,8,5,5,5,8,22,5,26,0,0,0,0,10,0,0,39,0,39,0,0,0,0,0,0,5,5,5,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,7,5,5,21,5,8,5,23,5,5,5,22,6,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,19,0,17,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,18,19,0,39,0,39,0,0,4,8,5,5,5,22,6,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,16,0,0,16,0,7,21,22,8,5,5,22,23,22,5,8,5,22,8,21,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,16,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,10,0,0,0,0,0,0,0,0,25,9,0,0,0,0,0,4,21,22,8,5,5,22,21,5,5,8,5,5,5,29,0,0,28,22,21,8,29,0,0,0,0,0,0,0,0,27,5,8,6},
-    .chars = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,54,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,52,0,53,0,0,0,33,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,1,0,27,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,49,0,0,0,0,0,0,27,0,0,0,26,0,0,0,31,0,0,33,0,56,0,0,0,0,56,0,31,1,0,0,0,0,0,0,49,49,49,0,0,0,0,0,0,0,0,46,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,40,49,0,0,10,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,53,0,0,0,51,0,0,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,35,0,59,59,59,0,0,0,35,0,33,0,24,0,0,0,48,0,40,0,0,0,20,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,10,0,0,59,0,49,0,0,0,30,0,20,0,32,0,53,0,0,0,17,0,11,33,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,17,0,0,30,0,20,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,30,0,0,0,0,0}
-},
-
-{
-  .width = 34,
-  .height = 31,
-  .title = "Bee Amazed",
-  .tiles = {39,39,39,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,39,39,39,40,0,0,58,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,60,0,0,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,58,39,0,39,39,39,39,39,39,39,0,39,0,0,0,0,0,0,50,0,39,39,39,39,39,39,39,39,39,39,39,0,39,60,0,49,0,40,0,0,0,0,0,0,0,49,0,0,0,0,0,0,48,0,40,0,0,0,0,0,0,0,0,0,40,0,40,0,0,40,0,49,0,0,39,39,39,39,39,58,39,39,39,39,39,39,60,0,40,0,39,39,39,39,39,39,39,0,49,0,49,0,0,49,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,40,0,0,0,0,0,40,0,48,0,40,0,0,50,0,49,39,39,39,39,39,39,39,39,0,39,0,0,35,35,36,35,60,0,49,36,35,35,39,0,49,0,49,0,49,0,0,49,0,40,0,0,0,49,0,0,0,49,0,49,0,0,0,0,0,0,0,0,40,0,0,0,50,0,40,0,50,0,49,0,0,48,0,49,0,0,0,48,0,39,0,48,0,58,39,39,39,39,39,39,39,39,49,0,39,0,39,0,49,0,49,0,50,0,0,49,0,58,0,0,0,49,0,40,0,49,0,0,0,0,40,0,0,0,0,0,40,0,48,0,48,0,50,0,40,0,49,0,0,60,0,0,0,39,0,39,0,49,0,40,39,39,39,39,59,39,39,35,39,0,49,0,50,0,39,0,48,0,49,0,49,0,0,39,39,39,39,40,0,59,0,40,0,49,0,0,0,0,0,0,39,0,48,0,58,0,48,0,60,0,49,0,59,0,48,0,0,49,0,0,0,40,0,0,0,49,0,49,0,39,28,5,5,29,49,0,50,0,0,0,50,0,0,0,48,0,0,0,49,0,0,40,0,39,0,58,39,39,39,40,0,50,0,49,0,0,0,0,49,0,58,39,39,0,58,35,39,0,49,0,0,0,49,0,0,39,0,48,0,0,0,39,0,60,0,49,0,49,0,0,0,0,49,0,0,0,50,0,0,0,40,0,50,0,0,0,49,0,0,40,0,50,0,39,0,50,0,0,0,58,0,49,0,0,0,0,58,39,39,0,48,0,39,0,49,0,49,0,39,0,50,0,0,39,0,48,0,48,0,39,0,39,0,0,0,49,0,0,0,0,0,0,48,0,50,0,40,0,40,0,40,0,50,0,49,0,0,40,0,50,0,49,0,48,0,40,0,39,0,49,0,0,0,0,39,0,50,0,48,0,50,0,49,0,49,0,49,0,49,0,0,39,0,48,0,40,0,39,0,39,0,49,0,58,38,37,38,37,60,0,48,0,50,0,48,0,40,0,49,0,40,0,49,0,0,40,0,50,0,49,0,50,0,40,0,39,0,0,39,0,0,0,0,0,50,0,48,0,40,0,49,0,48,0,49,0,48,0,0,39,0,48,0,50,0,58,0,39,0,58,39,39,40,0,39,39,39,39,48,0,60,0,50,0,40,0,60,0,48,0,49,0,0,40,0,50,0,49,0,0,0,40,0,0,0,0,49,0,50,0,0,0,50,0,0,0,48,0,49,0,0,0,59,0,40,0,0,39,0,48,0,58,35,36,35,59,35,36,35,0,40,0,48,0,0,0,58,36,35,36,60,0,58,36,35,36,39,0,49,0,0,40,0,50,0,0,0,0,0,0,0,0,0,0,49,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,49,0,39,60,0,58,39,39,39,39,39,39,39,39,39,39,40,0,58,39,39,39,39,39,39,39,39,39,39,39,39,0,50,0,58,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,40,40,0,0,39,7,21,22,23,8,22,21,9,39,0,39,7,21,23,22,21,8,23,8,21,22,8,23,22,21,9,50,0,0,39,58,39,39,60,17,0,0,0,0,35,0,19,40,0,58,17,0,0,0,0,0,0,0,0,0,0,0,0,0,19,58,39,39,60,0,0,35,0,0,0,0,0,0,10,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,10,0,0,0,0,0,59,28,5,8,29,0,28,8,22,23,8,5,5,5,8,21,5,5,22,23,8,29},
-  .chars = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,33,32,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,0,52,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,46,37,37,0,0,0,56,0,34,0,0,56,0,0,33,0,56,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
-},
+    .tiles = LEVELLAYER(sg_level2tiles),
+    .chars = LEVELLAYER(sg_level2chars),
+    .tilessize = LEVELSIZE(sg_level2tiles),
+    .charssize = LEVELSIZE(sg_level2chars),
+    .packed = LEVELPACKED
+  },
 
-{
-  .width = 36,
-  .height = 12,
-  .title = "Bee Afraid, Bee Very Afraid",
-  .tiles = {28,5,22,8,21,5,22,8,23,5,23,5,29,39,10,39,28,21,23,22,5,8,5,5,22,23,21,5,5,21,8,23,29,39,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,4,8,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,14,0,16,0,0,0,0,0,0,0,0,0,0,28,21,22,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,10,39,0,0,0,5,21,23,22,5,5,22,22,23,8,6,0,0,0,4,6,0,0,0,0,0,0,0,0,0,0,4,8,29,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,39,0,0,0,5,5,21,8,5,5,21,5,5,5,0,0,0,4,23,21,23,8,22,6,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,39,0,0,0,39,28,5,5,22,23,5,5,8,5,5,22,5,21,23,22,5,5,5,5,5,8,5,22,21,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,22,5,5,23,22,21,29,59,28,22,5,5,5,22,5,5,5,23,22,5,5,22,5,5,5,5,23,22,5,5,22,5,5,23,29},
-  .chars = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,25,26,0,48,0,49,0,0,0,0,0,0,0,0,25,26,0,0,51,0,0,0,0,40,0,54,0,0,0,1,0,0,0,0,0,0,0,0,0,40,0,40,0,0,36,35,36,0,0,0,0,0,0,54,0,55,0,0,0,40,0,0,17,52,19,11,17,0,0,0,0,53,0,0,0,49,0,50,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,33,56,37,0,34,33,59,33,59,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,59,33,56,0,0,0,0,17,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,33,33,34,56,34,33,34,0,34,0,0,0,0,0,0,59,0,56,0,0,0,0,52,0,0,0,0,0,0,19,0,0,0,17,25,0,0,0,0,0,0,0,0,0,0,26,0,53,0,0,0,0,0,0,0,0,0,0,36,33,58,34,33,34,33,34,33,60,35,36,37,36,35,33,34,33,34,33,0,0,33,36,0,0,17,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,48,0,0,0,0,54,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,54,0,0,0,0,0,0,57,56,0,57,59,56,0,0,49,57,0,31,31,33,36,31,0,31,0,0,34,33,31,31,0,0,36,31,0,0,33,31,31,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
-},
+  {
+    .width = 34,
+    .height = 31,
+    .title = "Bee Amazed",
+    .tiles = LEVELLAYER(sg_level3tiles),
+    .chars = LEVELLAYER(sg_level3chars),
+    .tilessize = LEVELSIZE(sg_level3tiles),
+    .charssize = LEVELSIZE(sg_level3chars),
+    .packed = LEVELPACKED
+  },
 
-{
-  .width = 20,
-  .height = 70,
-  .title = "Plan Bee",
-  .tiles = {35,35,35,35,35,35,35,35,35,35,35,35,35,36,39,35,35,35,35,35,0,0,0,0,0,0,35,0,0,0,35,0,0,0,40,0,0,0,0,0,0,36,35,35,35,35,35,0,39,0,35,0,39,0,59,35,35,0,35,35,0,0,0,0,0,0,0,0,40,0,0,0,40,0,0,0,0,0,0,0,35,35,35,35,35,35,35,35,59,35,35,35,59,35,36,0,35,35,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,21,9,0,0,0,7,9,0,0,0,7,5,21,23,22,5,8,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,39,0,0,0,0,0,0,0,0,39,0,0,0,39,0,0,0,0,39,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,5,5,5,5,5,5,5,29,39,28,5,22,5,5,5,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,21,8,5,5,22,21,8,5,23,5,5,5,29,0,28,22,23,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,36,36,35,35,35,35,35,35,35,35,35,35,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,35,35,35,36,35,35,35,35,35,35,36,0,36,0,35,35,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,35,35,59,0,36,35,35,35,35,36,36,35,35,35,35,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,35,35,36,35,35,35,39,35,35,36,0,0,0,35,35,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,35,35,35,36,36,35,35,35,36,0,0,58,35,35,35,35,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,35,35,35,36,35,35,35,35,36,36,35,35,36,39,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,8,5,23,8,8,23,5,5,8,22,5,21,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,23,21,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,8,9,0,0,0,0,28,8,8,21,5,23,8,23,8,26,0,0,10,0,0,19,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,0,36,35,35,35,0,35,0,0,0,0,0,0,39,0,0,0,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,35,35,0,35,35,0,0,0,0,0,0,0,0,39,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,35,0,35,35,0,35,0,35,35,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,35,0,35,35,0,36,0,36,35,35,35,35,35,35,35,35,35,35,36,0,35,35,36,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,35,0,35,0,0,0,0,0,0,36,0,0,0,35,35,35,35,35,35,35,36,0,0,0,0,0,0,9,0,36,36,36,0,0,0,0,0,0,0,0,0,0,7,22,0,23,5,16,0,0,0,36,35,35,35,35,35,35,36,0,0,0,14,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,27,5,8,23,22,21,6,0,4,5,21,22,23,8,5,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,20,0,0,0,0,0,39,0,39,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,10,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,21,22,23,22,22,21,22,23,22,22,21,23,22,21,23,6,0,7,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,10,0,0,0,0,0,10,0,0,0,0,0,28,8,29,0,0,10},
-  .chars = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,33,0,0,0,0,0,0,33,0,0,0,0,0,33,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,19,0,0,0,17,19,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,26,0,0,0,0,0,0,0,49,0,0,0,0,49,0,0,0,0,0,0,0,0,50,34,0,0,49,0,48,0,0,49,0,49,0,0,0,50,0,0,0,0,48,0,0,0,49,0,49,0,0,50,0,50,0,0,0,49,0,20,0,0,50,0,0,0,0,0,49,0,0,48,0,49,0,0,0,0,0,30,0,0,48,0,0,0,49,0,0,0,0,49,0,49,0,0,0,49,0,0,0,0,50,0,0,0,49,0,49,0,0,0,0,49,0,0,0,48,0,0,0,0,59,0,0,0,0,0,50,0,0,49,0,0,0,0,0,49,0,0,0,0,0,0,0,0,48,0,49,0,0,49,0,49,0,0,0,0,0,0,0,0,0,0,0,35,59,34,59,36,34,59,36,59,34,0,36,59,37,35,0,34,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,34,0,17,0,0,0,25,26,0,0,0,0,49,0,0,0,0,0,0,0,0,0,57,0,31,0,0,0,0,0,31,0,59,57,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,17,0,0,0,0,0,0,0,0,0,33,0,1,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,56,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,32,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,33,0,0,0,0,33,0,0,0,0,33,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,56,32,0,0,0,0,37,0,0,56,0,0,56,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,1,0,0,0,0,0,0,0,0,0,33,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,6,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,49,0,0,49,0,0,0,0,0,0,0,0,0,0,0,35,0,0,19,0,49,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,49,0,0,49,0,0,0,0,0,0,0,0,35,0,0,0,0,49,0,0,49,0,0,49,0,0,0,0,0,0,0,0,0,0,0,34,33,59,33,34,58,34,33,60,33,34,0,0,0,52,0,0,35,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,33,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,37,0,0,0,0,0,0,0,0,0,0,37,34,0,0,10,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,19,46,17,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,30,0,0,34,0,0,40,0,40,0,0,0,34,0,0,0,0,0,0,59,0,0,0,0,0,0,49,0,49,0,0,0,0,0,0,0,56,0,0,0,0,0,0,53,0,0,0,0,49,0,0,0,30,52,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,57,0,0,60,0,49,0,0,33,56,0,33,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,9,11,4,6,0,4,6,0,4,6,0,4,6,0,16,0,0,0,0,17,16,0,14,16,35,14,16,36,14,16,35,14,16,32,16,0,0,33,0,0,25,5,26,27,5,24,27,5,24,27,5,26,25,29,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,51,0,0,32,0,0,36,0,0,32,0,0,36,35,19,0,0,32,0,0,0,0,0,10,0,0,0,0,0,10,0,0,0,0,0,0,17,0}
-},
+  {
+    .width = 36,
+    .height = 12,
+    .title = "Bee Afraid, Bee Very Afraid",
+    .tiles = LEVELLAYER(sg_level4tiles),
+    .chars = LEVELLAYER(sg_level4chars),
+    .tilessize = LEVELSIZE(sg_level4tiles),
+    .charssize = LEVELSIZE(sg_level4chars),
+    .packed = LEVELPACKED
+  },
 
-{
-  .width = 76,
-  .height = 12,
-  .title = "Zombee Apocalypse",
-  .tiles = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,39,39,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,39,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,28,29,0,0,0,0,0,0,0,0,0,0,0,0,7,21,9,0,0,0,0,0,0,0,0,0,0,0,0,7,23,9,0,0,0,0,0,0,0,0,7,23,9,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,22,9,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,23,9,0,0,0,0,0,0,7,8,9,0,0,0,7,21,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,17,0,19,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,28,29,0,0,0,28,29,0,0,0,0,28,29,0,0,0,28,29,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,28,29,0,0,0,28,29,0,0,0,28,22,23,8,29,0},
-  .chars = {6,0,0,0,0,25,26,0,0,0,0,0,0,0,0,16,0,0,14,0,0,0,0,0,0,0,0,0,33,54,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,46,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,55,33,0,0,0,0,49,0,16,33,0,0,0,0,0,0,0,0,0,0,0,0,0,16,33,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,40,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,49,0,27,6,0,0,0,0,0,0,32,56,32,0,0,0,0,27,6,4,26,0,0,0,0,32,56,32,0,0,0,48,0,0,0,0,35,55,33,0,0,0,35,55,35,0,40,0,0,0,0,0,0,0,49,50,49,0,0,0,0,0,0,0,33,55,33,0,0,0,0,0,0,0,0,35,59,35,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,17,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,50,49,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,33,35,33,0,0,0,48,49,40,0,0,33,33,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,56,31,0,0,0,0,0,0,32,56,32,0,0,0,32,56,32,0,0,0,0,0,0,34,0,50,0,0,34,0,0,0,0,0,35,0,0,0,0,0,49,0,0,0,0,0,0,0,49,48,49,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,48,0,0,10,0,0,0,0,0,10,0,0,0,0,0,49,0,0,0,0,0,0,0,40,49,48,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,51,0,0,0,0,39,0,0,0,53,0,0,0,0,0,0,0,0,53,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,59,59,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,19,0,0,0,59,0,0,0,0,0,33,33,0,0,33,33,0,0,0,36,32,0,0,0,0,33,33,0,0,0,32,37,0,50,0,37,32,0,0,0,0,33,33,0,0,0,0,32,59,0,0,0,0,33,33,0,0,0,0,0,0,0,0,0,37,32,0,0,0,35,35,0,0,0,0,0,0,0,35,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
-},
+  {
+    .width = 20,
+    .height = 70,
+    .title = "Plan Bee",
+    .tiles = LEVELLAYER(sg_level5tiles),
+    .chars = LEVELLAYER(sg_level5chars),
+    .tilessize = LEVELSIZE(sg_level5tiles),
+    .charssize = LEVELSIZE(sg_level5chars),
+    .packed = LEVELPACKED
+  },
 
-{
-  .width = 40,
-  .height = 12,
-  .title = "Bee Kind",
-  .tiles = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,5,5,5,5,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,39,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,10,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,6,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,19,0,30,0,0,0,28,29,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,39,0,0,0,0,0,0,8,22,6,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,40,0,40,0,0,0,0,0,0,0,0,0,5,6,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,40,0,28,5,5,29,0,0,0,0,0,0,5,5,6,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,27,29,0,0,0,0,0,10,0,0,0,0,0,28,5,8,8,5,5,21,22,23,8,29,58,0,60,28,5,5,5,29},
-  .chars = {56,31,31,56,31,31,0,0,0,0,0,0,0,25,26,0,0,0,0,14,0,0,0,0,0,14,0,0,16,33,34,0,0,0,0,25,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,14,0,0,0,0,0,14,0,0,27,5,6,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,28,26,0,0,0,0,0,14,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,54,33,0,0,0,0,0,33,0,0,0,33,0,0,52,0,0,0,0,17,0,0,0,0,0,36,54,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,40,0,10,0,0,0,40,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,33,0,52,0,49,0,0,0,33,0,49,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,31,31,36,56,0,0,0,0,0,0,0,10,0,0,0,40,0,0,0,10,0,40,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,31,35,0,0,0,0,0,0,0,33,0,49,0,33,0,0,0,49,0,10,0,0,0,0,0,0,0,0,0,0,0,0,31,0,57,31,11,31,0,25,0,0,56,31,31,0,0,0,0,10,0,40,0,10,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,37,33,27,0,0,0,0,0,33,0,0,0,59,0,0,0,33,0,59,56,35,37,31,0,33,0,0,46,31,0,51,0,31,0,31,56,57,0,0,0,28,29,0,0,0,0,0,0,10,0,0,0,0,0,0,0,10,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
-}
+  {
+    .width = 76,
+    .height = 12,
+    .title = "Zombee Apocalypse",
+    .tiles = LEVELLAYER(sg_level6tiles),
+    .chars = LEVELLAYER(sg_level6chars),
+    .tilessize = LEVELSIZE(sg_level6tiles),
+    .charssize = LEVELSIZE(sg_level6chars),
+    .packed = LEVELPACKED
+  },
 
+  {
+    .width = 40,
+    .height = 12,
+    .title = "Bee Kind",
+    .tiles = LEVELLAYER(sg_level7tiles),
+    .chars = LEVELLAYER(sg_level7chars),
+    .tilessize = LEVELSIZE(sg_level7tiles),
+    .charssize = LEVELSIZE(sg_level7chars),
+    .packed = LEVELPACKED
+  }
 };
+
+static constexpr uint8_t NUMLEVELS = sizeof(levels)/sizeof(levels[0]);
+
+#endif // ! defined GUARD_BEEKIND_LEVELS_H
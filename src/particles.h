@@ -0,0 +1,138 @@
+//=============================================================================
+//	FILE:					particles.h
+//	SYSTEM:
+//	DESCRIPTION:	Fixed size particle pool, held as arrays of each attribute
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_PARTICLES_H
+#define GUARD_BEEKIND_PARTICLES_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "fixed.h"
+
+#define PARTICLEMAX 1024 // Most particles alive at once, more are dropped
+#define PARTICLEDIRS 360 // Directions particles emanate in, one per whole degree
+
+// Unit vector of each direction particles can travel in
+struct particledirs
+{
+	std::array<real, PARTICLEDIRS> dx;
+	std::array<real, PARTICLEDIRS> dy;
+};
+
+// Work out the direction table, so making a particle just looks its direction up
+inline struct particledirs
+particles_directions()
+{
+	struct particledirs dirs;
+
+	for (uint32_t deg=0; deg<PARTICLEDIRS; deg++)
+	{
+		float ang=deg*(3.14159265f/180);
+
+		dirs.dx[deg]=cos(ang);
+		dirs.dy[deg]=sin(ang);
+	}
+
+	return dirs;
+}
+
+inline const struct particledirs sg_particledirs=particles_directions();
+
+// Particles, those alive are packed at the front of each array in the order they were made. Each
+// array is its own run of reals (or bytes) so the update loop vectorises
+struct particlepool
+{
+	uint32_t count; // Particles alive
+
+	std::vector<real> x; // x position of centre point
+	std::vector<real> y; // y position of centre point
+	std::vector<real> dx; // direction to travel from centre point, as a unit vector
+	std::vector<real> dy;
+	std::vector<real> t; // travel (from centre point)
+	std::vector<real> a; // Alpha
+
+	std::vector<uint8_t> r; // Red
+	std::vector<uint8_t> g; // Green
+	std::vector<uint8_t> b; // Blue
+	std::vector<uint8_t> s; // size of "chunk"
+};
+
+// Remove all particles, making room for PARTICLEMAX the first time
+inline void
+particles_clear(struct particlepool & p)
+{
+	if (p.x.size()!=PARTICLEMAX)
+	{
+		p.x.assign(PARTICLEMAX, 0); p.y.assign(PARTICLEMAX, 0);
+		p.dx.assign(PARTICLEMAX, 0); p.dy.assign(PARTICLEMAX, 0);
+		p.t.assign(PARTICLEMAX, 0); p.a.assign(PARTICLEMAX, 0);
+		p.r.assign(PARTICLEMAX, 0); p.g.assign(PARTICLEMAX, 0); p.b.assign(PARTICLEMAX, 0);
+		p.s.assign(PARTICLEMAX, 0);
+	}
+
+	p.count=0;
+}
+
+// Add a particle, returns its index or -1 when the pool is full
+inline int32_t
+particles_add(struct particlepool & p)
+{
+	if (p.count>=PARTICLEMAX)
+		return -1;
+
+	return p.count++;
+}
+
+// Move every particle onwards by travel, fall down by fall, and fade by decay
+inline void
+particles_update(struct particlepool & p, const real travel, const real fall, const real decay)
+{
+	real *__restrict t=p.t.data();
+	real *__restrict y=p.y.data();
+	real *__restrict a=p.a.data();
+
+	for (uint32_t i=0; i<p.count; i++)
+	{
+		t[i]+=travel;
+		y[i]+=fall;
+		a[i]-=decay;
+	}
+}
+
+// Remove particles which have faded out, keeping the rest in order. Returns how many went
+inline uint32_t
+particles_compact(struct particlepool & p)
+{
+	uint32_t live=0;
+
+	for (uint32_t i=0; i<p.count; i++)
+	{
+		if (p.a[i]<=0)
+			continue;
+
+		if (live!=i)
+		{
+			p.x[live]=p.x[i]; p.y[live]=p.y[i];
+			p.dx[live]=p.dx[i]; p.dy[live]=p.dy[i];
+			p.t[live]=p.t[i]; p.a[live]=p.a[i];
+			p.r[live]=p.r[i]; p.g[live]=p.g[i]; p.b[live]=p.b[i];
+			p.s[live]=p.s[i];
+		}
+
+		live++;
+	}
+
+	uint32_t removed=p.count-live;
+
+	p.count=live;
+
+	return removed;
+}
+
+#endif // ! defined GUARD_BEEKIND_PARTICLES_H
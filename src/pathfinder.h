@@ -1,9 +1,9 @@
 struct pathnode
 {
-	int16_t id; // square on numbered grid
-	int16_t x; // x position
-	int16_t y; // y position
-	int16_t p; // previous node that led here (or -1)
+	int32_t id; // square on numbered grid
+	int32_t x; // x position
+	int32_t y; // y position
+	int32_t p; // previous node that led here (or -1)
 	float g; // cost to get here
 	float h; // manhattan cost
 	float f; // final cost
@@ -11,42 +11,59 @@ struct pathnode
 
 // A* algorithm from pseudocode in Wireframe magazine issue 48
 // by Paul Roberts
-std::vector<int16_t>
-pathfinder(const int16_t src, const int16_t dest)
+std::vector<int32_t>
+pathfinder(const struct gamestate & gs, const int32_t src, const int32_t dest)
 {
+	TRACE_SCOPE_ARG(gs, "pathfinder", "nodes");
+	counter_add(COUNTER_PATHFINDER);
+
+	// Skip the search when src and dest are in separate areas, as it would visit every tile reachable from src
+	const uint32_t area=(uint32_t)gs.width*gs.height;
+	if ((src>=0) && (dest>=0) && ((uint32_t)src<area) && ((uint32_t)dest<area))
+	{
+		const uint8_t srcregion=tilemap_at(gs.regions, src);
+		const uint8_t destregion=tilemap_at(gs.regions, dest);
+
+		if ((srcregion!=0) && (destregion!=0) && (srcregion!=destregion))
+		{
+			counter_add(COUNTER_PATHFAILED);
+			return {};
+		}
+	}
+
 	std::vector<struct pathnode> openlist; // List of node ids yet to visit
 	std::vector<struct pathnode> closedlist; // List of visited node ids yet
 
-	const int16_t dx=Math_floor(dest%gs.width); // Destination node X grid position
-	const int16_t dy=Math_floor(dest/gs.width); // Destination node Y grid position
+	const int32_t dx=Math_floor(dest%gs.width); // Destination node X grid position
+	const int32_t dy=Math_floor(dest/gs.width); // Destination node Y grid position
 
 	struct pathnode n; // Next node
-	const int16_t nx=Math_floor(src%gs.width); // Next node X grid position
-	const int16_t ny=Math_floor(src/gs.width); // Next node Y grid position
+	const int32_t nx=Math_floor(src%gs.width); // Next node X grid position
+	const int32_t ny=Math_floor(src/gs.width); // Next node Y grid position
 
-	int16_t c=-1; // Check node id
-	int16_t cx=-1; // Check node X grid position
-	int16_t cy=-1; // Check node Y grid position
+	int32_t c=-1; // Check node id
+	int32_t cx=-1; // Check node X grid position
+	int32_t cy=-1; // Check node Y grid position
 
 	// Check if this grid position is solid (out of bounds to path)
-	auto issolid = [&](const int16_t x, const int16_t y)
+	auto issolid = [&](const int32_t x, const int32_t y)
 	{
 		// Out of bounds check
 		if ((x<0) || (x>=gs.width) || (y<0) || (y>=gs.height))
 			return true;
 
 		// Solid check
-		return (levels[gs.level].tiles[(y*gs.width)+x]!=0);
+		return (tilemap_get(gs.map, x, y)!=0);
 	};
 
 	// Determine cost (rough distance) from x1,y1 to x2,y2
-	auto manhattan_cost = [](const int16_t x1, const int16_t y1, const int16_t x2, const int16_t y2)
+	auto manhattan_cost = [](const int32_t x1, const int32_t y1, const int32_t x2, const int32_t y2)
 	{
 		return (abs(x1-x2)+abs(y1-y2));
 	};
 
 	// Add node to open list
-	auto addnode = [&](const int16_t id, const int16_t x, const int16_t y, const int16_t prev, const float acc)
+	auto addnode = [&](const int32_t id, const int32_t x, const int32_t y, const int32_t prev, const float acc)
 	{
 		float g=acc; // Cost to get here
 		float h=manhattan_cost(x, y, dx, dy);
@@ -68,9 +85,9 @@ pathfinder(const int16_t src, const int16_t dest)
 	auto findcheapestopenlist = [&]()
 	{
 		float cost=-1;
-		int16_t idx=0;
+		int32_t idx=0;
   
-		for (uint16_t i=0; i<openlist.size(); i++)
+		for (uint32_t i=0; i<openlist.size(); i++)
 		{
 			if ((cost==-1) || (openlist[i].f<cost))
 			{
@@ -84,17 +101,17 @@ pathfinder(const int16_t src, const int16_t dest)
 
 /*
 	// Get index to node id on given list
-	auto getidx = [](const std::vector<struct pathnode> & givenlist, const int16_t id)
+	auto getidx = [](const std::vector<struct pathnode> & givenlist, const int32_t id)
 	{
-		for (int16_t i=0; i<givenlist.size(); i++)
-			if (givenlist[i].id==id) return (int16_t)i;
+		for (int32_t i=0; i<givenlist.size(); i++)
+			if (givenlist[i].id==id) return (int32_t)i;
 
 		return -1;
 	};
 */
 
 	// Is given node id on the openlist
-	auto isopen = [&](const int16_t id)
+	auto isopen = [&](const int32_t id)
 	{
 		for (uint32_t i=0; i<openlist.size(); i++)
 			if (openlist[i].id==id) return true;
@@ -103,7 +120,7 @@ pathfinder(const int16_t src, const int16_t dest)
 	};
 
 	// Is given node id on the closedlist
-	auto isclosed = [&](const int16_t id)
+	auto isclosed = [&](const int32_t id)
 	{
 		for (uint32_t i=0; i<closedlist.size(); i++)
 			if (closedlist[i].id==id) return true;
@@ -112,7 +129,7 @@ pathfinder(const int16_t src, const int16_t dest)
 	};
 
 	// Move given node from open to closed list
-	auto movetoclosedlist = [&](const int16_t id)
+	auto movetoclosedlist = [&](const int32_t id)
 	{
 		// Find id in openlist list
 		for (uint32_t i=0; i<openlist.size(); i++)
@@ -126,7 +143,7 @@ pathfinder(const int16_t src, const int16_t dest)
 	};
 
 	// Find parent of given node, to backtrace path
-	auto findparent = [&](const int16_t id)
+	auto findparent = [&](const int32_t id)
 	{
 		uint32_t i;
   
@@ -138,18 +155,18 @@ pathfinder(const int16_t src, const int16_t dest)
 			if (openlist[i].id==id)
 				return openlist[i].p;
   
-		return (int16_t)-1;
+		return (int32_t)-1;
 	};
 
 	// Retrace path back to start position
-	auto retracepath = [&](const int16_t dest)
+	auto retracepath = [&](const int32_t dest)
 	{
-		std::vector<int16_t> finalpath;
+		std::vector<int32_t> finalpath;
 
 		// Check for path being found
 		if (n.id==dest)
 		{
-			int16_t prev=findparent(dest);
+			int32_t prev=findparent(dest);
 			finalpath.insert(finalpath.begin(), dest);
 
 			while (prev!=-1)
@@ -163,7 +180,7 @@ pathfinder(const int16_t src, const int16_t dest)
 		return finalpath;
 	};
 
-	auto explore = [&](const int16_t x, const int16_t y)
+	auto explore = [&](const int32_t x, const int32_t y)
 	{
 		c=n.id+(x+(y*gs.width));
 		cx=n.x+x;
@@ -191,6 +208,8 @@ pathfinder(const int16_t src, const int16_t dest)
 		// Check if n is the target node
 		if (n.id==dest) break;
 
+		counter_add(COUNTER_PATHNODES);
+
 		// Check for unexplored nodes connecting to n
 		explore( 0, -1); // Above
 		explore( 1,  0); // Right
@@ -201,5 +220,12 @@ pathfinder(const int16_t src, const int16_t dest)
 		movetoclosedlist(n.id);
 	}
 
-	return retracepath(dest);
+	TRACE_ARG(openlist.size()+closedlist.size());
+
+	std::vector<int32_t> finalpath=retracepath(dest);
+
+	if (finalpath.size()==0)
+		counter_add(COUNTER_PATHFAILED);
+
+	return finalpath;
 }
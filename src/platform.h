@@ -0,0 +1,49 @@
+//=============================================================================
+//	FILE:					platform.h
+//	SYSTEM:
+//	DESCRIPTION:	Thin interface between the game simulation and the host
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_PLATFORM_H
+#define GUARD_BEEKIND_PLATFORM_H
+
+#include <cstdint>
+
+// Inputs read by the game
+enum platform_input
+{
+	INPUT_PLAYER1_UP,
+	INPUT_PLAYER1_DOWN,
+	INPUT_PLAYER1_LEFT,
+	INPUT_PLAYER1_RIGHT,
+	INPUT_PLAYER1_BUTTON1,
+	INPUT_DIPSW1,
+
+	INPUT_COUNT
+};
+
+// Implemented once per host (main.cpp for the JAMMA SDK, headless.cpp for the
+// SDK-free driver), the game only ever talks to the outside world through these
+
+// Sample all inputs at once as a mask of (1<<platform_input), the game calls
+// this once just before each update so input is as fresh as it can be
+uint32_t platform_inputs();
+
+// Monotonic clock in microseconds, used for profiling
+uint64_t platform_clock();
+
+// Set colour used by subsequent drawing
+void platform_set_colour(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a=255);
+
+// Clear the screen to the current colour
+void platform_clear();
+
+// Fill a rectangle with the current colour
+void platform_solid_rectangle(const int32_t x, const int32_t y, const int32_t w, const int32_t h);
+
+// Draw tile id from the game tileset
+void platform_image(const int32_t x, const int32_t y, const uint8_t id, const bool flip);
+
+#endif // ! defined GUARD_BEEKIND_PLATFORM_H
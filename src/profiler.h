@@ -0,0 +1,158 @@
+//=============================================================================
+//	FILE:					profiler.h
+//	SYSTEM:
+//	DESCRIPTION:	Per-phase frame profiler
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_PROFILER_H
+#define GUARD_BEEKIND_PROFILER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Phases of a frame which are timed
+enum profilephase
+{
+	PHASE_UPDATEMOVEMENTS,
+	PHASE_UPDATECHARAI,
+	PHASE_UPDATEPLAYERCHAR,
+	PHASE_CHECKSPAWN,
+	PHASE_SEQUENCE,
+	PHASE_DRAWPARALLAX,
+	PHASE_DRAWLEVEL,
+	PHASE_DRAWCHARS,
+	PHASE_DRAWSHOTS,
+	PHASE_DRAWPARTICLES,
+	PHASE_DRAWMSGBOX,
+	PHASE_UPDATE, // Whole of game_update()
+	PHASE_DRAW, // Whole of game_draw()
+
+	PHASE_COUNT
+};
+
+// Short names for the overlay
+static const char * const sg_phasenames[PHASE_COUNT] =
+{
+	"MOVE", "AI", "PCOL", "SPWN", "SEQ",
+	"DPAR", "DLVL", "DCHR", "DSHT", "DPRT", "DMSG",
+	"UPD", "DRAW"
+};
+
+#define PROFILEHISTORY 128 // Frames of history kept for stats
+
+struct profiler
+{
+	uint64_t (*clock)(); // Microsecond clock, so it works on any host
+	uint32_t current[PHASE_COUNT]; // Time spent in each phase this frame (us)
+	uint32_t history[PHASE_COUNT][PROFILEHISTORY]; // Previous frames (us)
+	uint32_t frames[PROFILEHISTORY]; // Previous whole frame times, update+draw (us)
+	uint32_t pos; // Next history slot to write
+	uint32_t count; // Number of history slots filled
+};
+
+// Rolling stats for a phase
+struct profilestats
+{
+	uint32_t min;
+	uint32_t avg;
+	uint32_t p99;
+};
+
+// Start profiling with given clock, or NULL to disable timing
+inline void
+profile_reset(struct profiler & prof, uint64_t (*clock)())
+{
+	memset(&prof, 0, sizeof(prof));
+	prof.clock=clock;
+}
+
+// Add time to a phase
+inline void
+profile_add(struct profiler & prof, const profilephase phase, const uint32_t us)
+{
+	prof.current[phase]+=us;
+}
+
+// Move the current frame into the history, ready for the next frame
+inline void
+profile_endframe(struct profiler & prof)
+{
+	for (int i=0; i<PHASE_COUNT; i++)
+	{
+		prof.history[i][prof.pos]=prof.current[i];
+		prof.current[i]=0;
+	}
+
+	prof.frames[prof.pos]=prof.history[PHASE_UPDATE][prof.pos]+prof.history[PHASE_DRAW][prof.pos];
+
+	prof.pos=(prof.pos+1)%PROFILEHISTORY;
+	if (prof.count<PROFILEHISTORY) prof.count++;
+}
+
+// Get time spent in a phase during the last completed frame
+inline uint32_t
+profile_last(const struct profiler & prof, const profilephase phase)
+{
+	if (prof.count==0) return 0;
+
+	return prof.history[phase][(prof.pos+PROFILEHISTORY-1)%PROFILEHISTORY];
+}
+
+// Get the whole time of the last completed frame, update+draw
+inline uint32_t
+profile_lastframe(const struct profiler & prof)
+{
+	if (prof.count==0) return 0;
+
+	return prof.frames[(prof.pos+PROFILEHISTORY-1)%PROFILEHISTORY];
+}
+
+// Get min/avg/p99 of a phase over the history
+inline struct profilestats
+profile_stats(const struct profiler & prof, const profilephase phase)
+{
+	struct profilestats stats={0, 0, 0};
+	uint32_t sorted[PROFILEHISTORY];
+	uint64_t total=0;
+
+	if (prof.count==0)
+		return stats;
+
+	for (uint32_t i=0; i<prof.count; i++)
+	{
+		sorted[i]=prof.history[phase][i];
+		total+=sorted[i];
+	}
+
+	std::sort(sorted, sorted+prof.count);
+
+	stats.min=sorted[0];
+	stats.avg=total/prof.count;
+	stats.p99=sorted[((prof.count*99)+99)/100-1];
+
+	return stats;
+}
+
+// Times the enclosing scope into a phase
+struct profilescope
+{
+	struct profiler & prof;
+	const profilephase phase;
+	const uint64_t start;
+
+	profilescope(struct profiler & p, const profilephase ph) :
+		prof(p), phase(ph), start((p.clock!=NULL)?p.clock():0)
+	{
+	}
+
+	~profilescope()
+	{
+		if (prof.clock!=NULL)
+			profile_add(prof, phase, prof.clock()-start);
+	}
+};
+
+#endif // ! defined GUARD_BEEKIND_PROFILER_H
@@ -0,0 +1,77 @@
+//=============================================================================
+//	FILE:					random.h
+//	SYSTEM:
+//	DESCRIPTION:	Small seedable deterministic random number generator
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_RANDOM_H
+#define GUARD_BEEKIND_RANDOM_H
+
+#include <cstdint>
+
+// xoshiro128** by David Blackman and Sebastiano Vigna, gives the same
+// sequence on every platform for a given seed
+struct rngstate
+{
+	uint32_t s[4];
+};
+
+// Seed a generator, each stream number gives an independent sequence from the same seed
+inline void
+rng_seed(struct rngstate & state, const uint64_t seed, const uint64_t stream)
+{
+	// Expand seed into the state with splitmix64
+	uint64_t x=seed^(stream*0xD1B54A32D192ED03ULL);
+
+	for (int i=0; i<4; i+=2)
+	{
+		uint64_t z=(x+=0x9E3779B97F4A7C15ULL);
+
+		z=(z^(z>>30))*0xBF58476D1CE4E5B9ULL;
+		z=(z^(z>>27))*0x94D049BB133111EBULL;
+		z=z^(z>>31);
+
+		state.s[i]=(uint32_t)z;
+		state.s[i+1]=(uint32_t)(z>>32);
+	}
+
+	// All zero state would only ever produce zeroes
+	if ((state.s[0]|state.s[1]|state.s[2]|state.s[3])==0)
+		state.s[0]=1;
+}
+
+// Next 32 bit random number
+inline uint32_t
+rng_next(struct rngstate & state)
+{
+	auto rotl = [](const uint32_t x, const int k)
+	{
+		return (x<<k)|(x>>(32-k));
+	};
+
+	const uint32_t result=rotl(state.s[1]*5, 7)*9;
+	const uint32_t t=state.s[1]<<9;
+
+	state.s[2]^=state.s[0];
+	state.s[3]^=state.s[1];
+	state.s[1]^=state.s[2];
+	state.s[0]^=state.s[3];
+
+	state.s[2]^=t;
+
+	state.s[3]=rotl(state.s[3], 11);
+
+	return result;
+}
+
+// Random number in the range 0 <= n < 1
+inline float
+rng_float(struct rngstate & state)
+{
+	// Top 24 bits fit exactly in a float mantissa
+	return (rng_next(state)>>8)*(1.0f/16777216.0f);
+}
+
+#endif // ! defined GUARD_BEEKIND_RANDOM_H
@@ -0,0 +1,228 @@
+//=============================================================================
+//	FILE:					replay.h
+//	SYSTEM:
+//	DESCRIPTION:	Input recording and deterministic replay
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_REPLAY_H
+#define GUARD_BEEKIND_REPLAY_H
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// File layout (all values little endian)
+//   4 bytes  "BKRP"
+//   1 byte   version
+//   1 byte   start level, 0 for intro otherwise 1 based level
+//   8 bytes  random seed
+//   4 bytes  number of updates
+//   runs     until end of file, each a LEB128 count of updates followed by
+//            1 byte of inputs (1<<platform_input) held for that many updates
+//
+// Inputs are latched once per update, so a replay reproduces a run exactly
+// provided the host calls game_update() and game_draw() in the same order
+#define REPLAYVERSION 1
+
+struct replay
+{
+	uint8_t level; // Start level, 0 for intro otherwise 1 based
+	uint64_t seed; // Random seed game was started with
+	uint32_t updates; // Number of updates recorded
+	std::vector<uint8_t> runs; // Encoded runs of inputs
+
+	// Recording/playback position
+	size_t pos; // Offset into runs of next run to read
+	uint32_t inputs; // Inputs for current run
+	uint32_t remain; // Updates left in current run
+};
+
+// Start a new empty recording
+inline void
+replay_reset(struct replay & rec, const uint8_t level, const uint64_t seed)
+{
+	rec.level=level;
+	rec.seed=seed;
+	rec.updates=0;
+	rec.runs.clear();
+
+	rec.pos=0;
+	rec.inputs=0;
+	rec.remain=0;
+}
+
+// Write out the run in progress
+inline void
+replay_flush(struct replay & rec)
+{
+	uint32_t count=rec.remain;
+
+	if (count==0) return;
+
+	while (count>=0x80)
+	{
+		rec.runs.push_back((count&0x7f)|0x80);
+		count>>=7;
+	}
+	rec.runs.push_back(count);
+	rec.runs.push_back(rec.inputs);
+
+	rec.remain=0;
+}
+
+// Record inputs for one update, only changes start a new run
+inline void
+replay_record(struct replay & rec, const uint32_t inputs)
+{
+	if ((rec.remain>0) && (inputs!=rec.inputs))
+		replay_flush(rec);
+
+	rec.inputs=inputs;
+	rec.remain++;
+	rec.updates++;
+}
+
+// Rewind to start of recording ready for playback
+inline void
+replay_rewind(struct replay & rec)
+{
+	rec.pos=0;
+	rec.inputs=0;
+	rec.remain=0;
+}
+
+// Decode the LEB128 count of a run at pos, moving pos past it. Returns false when it's cut short, or won't fit
+// in 32 bits
+inline bool
+replay_count(const std::vector<uint8_t> & runs, size_t & pos, uint32_t & count)
+{
+	uint8_t shift=0;
+
+	count=0;
+
+	while (pos<runs.size())
+	{
+		uint8_t code=runs[pos++];
+
+		// Fifth byte can only hold the top 4 bits, and must be the last
+		if ((shift==28) && (code>0x0f))
+			return false;
+
+		count|=(uint32_t)(code&0x7f)<<shift;
+
+		if (!(code&0x80))
+			return true;
+
+		shift+=7;
+	}
+
+	return false;
+}
+
+// Get inputs for next update, returns false when the recording is exhausted
+inline bool
+replay_play(struct replay & rec, uint32_t & inputs)
+{
+	if (rec.remain==0)
+	{
+		uint32_t count;
+
+		// Decode next run
+		if ((!replay_count(rec.runs, rec.pos, count)) || (rec.pos>=rec.runs.size()))
+			return false;
+
+		rec.inputs=rec.runs[rec.pos++];
+		rec.remain=count;
+
+		if (rec.remain==0)
+			return false;
+	}
+
+	rec.remain--;
+	inputs=rec.inputs;
+
+	return true;
+}
+
+// Check if playback has used every recorded update
+inline bool
+replay_finished(const struct replay & rec)
+{
+	return ((rec.remain==0) && (rec.pos>=rec.runs.size()));
+}
+
+// Save recording to file
+inline bool
+replay_save(struct replay & rec, const char *filename)
+{
+	FILE *fp=fopen(filename, "wb");
+	uint8_t header[18];
+
+	if (fp==NULL)
+		return false;
+
+	replay_flush(rec);
+
+	header[0]='B'; header[1]='K'; header[2]='R'; header[3]='P';
+	header[4]=REPLAYVERSION;
+	header[5]=rec.level;
+	for (int i=0; i<8; i++)
+		header[6+i]=(rec.seed>>(i*8))&0xff;
+	for (int i=0; i<4; i++)
+		header[14+i]=(rec.updates>>(i*8))&0xff;
+
+	bool ok=(fwrite(header, sizeof(header), 1, fp)==1);
+	if ((ok) && (rec.runs.size()>0))
+		ok=(fwrite(rec.runs.data(), rec.runs.size(), 1, fp)==1);
+
+	fclose(fp);
+
+	return ok;
+}
+
+// Load recording from file, ready for playback
+inline bool
+replay_load(struct replay & rec, const char *filename)
+{
+	FILE *fp=fopen(filename, "rb");
+	uint8_t header[18];
+	uint8_t buffer[1024];
+	size_t len;
+
+	if (fp==NULL)
+		return false;
+
+	if ((fread(header, sizeof(header), 1, fp)!=1) ||
+		(header[0]!='B') || (header[1]!='K') || (header[2]!='R') || (header[3]!='P') ||
+		(header[4]!=REPLAYVERSION))
+	{
+		fclose(fp);
+		return false;
+	}
+
+	replay_reset(rec, header[5], 0);
+	for (int i=0; i<8; i++)
+		rec.seed|=((uint64_t)header[6+i])<<(i*8);
+	for (int i=0; i<4; i++)
+		rec.updates|=((uint32_t)header[14+i])<<(i*8);
+
+	while ((len=fread(buffer, 1, sizeof(buffer), fp))>0)
+		rec.runs.insert(rec.runs.end(), buffer, buffer+len);
+
+	fclose(fp);
+
+	// Check every run decodes, each count being followed by its inputs
+	for (size_t pos=0; pos<rec.runs.size(); pos++)
+	{
+		uint32_t count;
+
+		if ((!replay_count(rec.runs, pos, count)) || (pos>=rec.runs.size()))
+			return false;
+	}
+
+	return true;
+}
+
+#endif // ! defined GUARD_BEEKIND_REPLAY_H
@@ -0,0 +1,112 @@
+//=============================================================================
+//	FILE:					rle.h
+//	SYSTEM:
+//	DESCRIPTION:	Run length encoding of level data, packed at compile time
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_RLE_H
+#define GUARD_BEEKIND_RLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Packed stream is made of
+//   0x00-0x7f           literal byte
+//   0x80|(count-1) byte run of count (1..128) copies of byte
+#define RLEMAXRUN 128
+
+// Pack src into dest (when not NULL), returning packed size
+constexpr size_t
+rle_encode(const uint8_t *src, const size_t size, uint8_t *dest)
+{
+	size_t pos=0;
+	size_t i=0;
+
+	while (i<size)
+	{
+		size_t count=1;
+
+		while (((i+count)<size) && (count<RLEMAXRUN) && (src[i+count]==src[i]))
+			count++;
+
+		if ((count>=3) || (src[i]>=0x80))
+		{
+			if (dest!=nullptr)
+			{
+				dest[pos]=0x80|(count-1);
+				dest[pos+1]=src[i];
+			}
+
+			pos+=2;
+			i+=count;
+		}
+		else
+		{
+			if (dest!=nullptr)
+				dest[pos]=src[i];
+
+			pos++;
+			i++;
+		}
+	}
+
+	return pos;
+}
+
+// Get packed size of an array
+template<size_t N>
+constexpr size_t
+rle_packedsize(const uint8_t (&src)[N])
+{
+	return rle_encode(src, N, nullptr);
+}
+
+// Pack an array, S must be rle_packedsize(src)
+template<size_t S, size_t N>
+constexpr std::array<uint8_t, S>
+rle_pack(const uint8_t (&src)[N])
+{
+	std::array<uint8_t, S> packed={};
+
+	rle_encode(src, N, packed.data());
+
+	return packed;
+}
+
+// Unpack srcsize bytes of src into size bytes of dest, zero filling and failing if src runs short
+inline bool
+rle_unpack(const uint8_t *src, const size_t srcsize, uint8_t *dest, const size_t size)
+{
+	size_t pos=0;
+	size_t i=0;
+
+	while ((i<size) && (pos<srcsize))
+	{
+		uint8_t code=src[pos++];
+
+		if (code&0x80)
+		{
+			if (pos>=srcsize) break;
+
+			uint8_t value=src[pos++];
+
+			for (uint32_t count=(code&0x7f)+1; (count>0) && (i<size); count--)
+				dest[i++]=value;
+		}
+		else
+			dest[i++]=code;
+	}
+
+	bool ok=(i==size);
+
+	while (i<size)
+		dest[i++]=0;
+
+	return ok;
+}
+
+#endif // ! defined GUARD_BEEKIND_RLE_H
@@ -0,0 +1,114 @@
+//=============================================================================
+//	FILE:					savestate.h
+//	SYSTEM:
+//	DESCRIPTION:	Binary snapshot writer/reader primitives
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_SAVESTATE_H
+#define GUARD_BEEKIND_SAVESTATE_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "fixed.h"
+
+// Snapshots start with "BKSS" and a version, then the fields of the game
+// state in a fixed order, in host byte order (little endian on all our
+// targets), and the fraction bits of real so fixed point and float builds
+// don't load each other's. Bump the version whenever the
+// order or size of anything written changes.
+#define SAVESTATEVERSION 9
+
+// Append values to a snapshot
+struct savewriter
+{
+	std::vector<uint8_t> & data;
+
+	template<typename T>
+	void raw(const T value)
+	{
+		const size_t pos=data.size();
+
+		data.resize(pos+sizeof(T));
+		memcpy(&data[pos], &value, sizeof(T));
+	}
+
+	void u8(const uint8_t value) { raw(value); }
+	void u16(const uint16_t value) { raw(value); }
+	void u32(const uint32_t value) { raw(value); }
+	void u64(const uint64_t value) { raw(value); }
+	void f32(const float value) { raw(value); }
+	void num(const real value) { raw(value); }
+	void flag(const bool value) { raw((uint8_t)(value?1:0)); }
+
+	void str(const std::string & value)
+	{
+		u16(value.length());
+		data.insert(data.end(), value.begin(), value.end());
+	}
+};
+
+// Read values back from a snapshot, once anything is out of range ok is
+// cleared and all further reads return zero
+struct savereader
+{
+	const uint8_t *data;
+	size_t size;
+	size_t pos;
+	bool ok;
+
+	template<typename T>
+	T raw()
+	{
+		T value={};
+
+		if ((!ok) || ((pos+sizeof(T))>size))
+		{
+			ok=false;
+			return value;
+		}
+
+		memcpy(&value, &data[pos], sizeof(T));
+		pos+=sizeof(T);
+
+		return value;
+	}
+
+	uint8_t u8() { return raw<uint8_t>(); }
+	uint16_t u16() { return raw<uint16_t>(); }
+	uint32_t u32() { return raw<uint32_t>(); }
+	uint64_t u64() { return raw<uint64_t>(); }
+	float f32() { return raw<float>(); }
+	real num() { return raw<real>(); }
+	bool flag() { return (raw<uint8_t>()!=0); }
+
+	std::string str()
+	{
+		const uint16_t len=u16();
+
+		if ((!ok) || ((pos+len)>size))
+		{
+			ok=false;
+			return std::string();
+		}
+
+		std::string value((const char *)&data[pos], len);
+		pos+=len;
+
+		return value;
+	}
+
+	// Check a count of items, each at least itemsize bytes, could be present
+	bool fits(const uint32_t count, const size_t itemsize)
+	{
+		if ((ok) && ((count*itemsize)>(size-pos)))
+			ok=false;
+
+		return ok;
+	}
+};
+
+#endif // ! defined GUARD_BEEKIND_SAVESTATE_H
@@ -0,0 +1,257 @@
+//=============================================================================
+//	FILE:					sequence.h
+//	SYSTEM:
+//	DESCRIPTION:	Scripted sequences as coroutines, stepped once per frame
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_SEQUENCE_H
+#define GUARD_BEEKIND_SEQUENCE_H
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <new>
+#include "timeline.h"
+
+struct gamestate;
+
+#define SEQUENCENONE 0 // No sequence running
+#define SEQUENCEBLOCK 256 // Size of pooled coroutine frames, bigger ones are allocated as usual
+
+// Free coroutine frames, kept for reuse by each thread
+struct sequencepool
+{
+	void *free; // First free block, each starts with a pointer to the next
+
+	~sequencepool()
+	{
+		while (free!=NULL)
+		{
+			void *next=*(void **)free;
+
+			::operator delete(free);
+			free=next;
+		}
+	}
+};
+
+inline thread_local struct sequencepool sg_sequencepool={NULL};
+
+inline void *
+sequencepool_alloc(const size_t size)
+{
+	if (size>SEQUENCEBLOCK)
+		return ::operator new(size);
+
+	void *block=sg_sequencepool.free;
+
+	if (block==NULL)
+		return ::operator new(SEQUENCEBLOCK);
+
+	sg_sequencepool.free=*(void **)block;
+
+	return block;
+}
+
+inline void
+sequencepool_free(void *block, const size_t size)
+{
+	if (size>SEQUENCEBLOCK)
+	{
+		::operator delete(block);
+		return;
+	}
+
+	*(void **)block=sg_sequencepool.free;
+	sg_sequencepool.free=block;
+}
+
+// Coroutine of a sequence, resumed from the sequencer's timeline when what it waits for comes about
+struct sequence
+{
+	struct promise_type
+	{
+		struct sequence get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+
+		static void *operator new(const size_t size) { return sequencepool_alloc(size); }
+		static void operator delete(void *block, const size_t size) { sequencepool_free(block, size); }
+	};
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+// Sequence being run. Its coroutine is resumed by items on its own timeline, added for each wait, so
+// a step only costs the waits which are due. Sequences keep no state across suspensions other than the
+// sequence frame and the game state, so a copy (or restored snapshot) rebuilds its coroutine from the
+// id when next stepped, and the timeline with it
+struct sequencer
+{
+	uint8_t id; // Sequence running, SEQUENCENONE when idle
+	uint64_t frame; // Frame of the sequence last stepped, counting from 0 (UINT64_MAX before its first step)
+	uint64_t base; // Sequence frame the timeline started at, when the coroutine was built
+	struct timelineobj tl; // Resumes of the coroutine, stepped along with the sequence
+	std::coroutine_handle<sequence::promise_type> handle; // Coroutine, empty until first stepped
+	std::coroutine_handle<sequence::promise_type> retired; // Coroutine replaced while it was running
+	bool running; // Coroutine is running now
+
+	sequencer() : id(SEQUENCENONE), frame(UINT64_MAX), base(0), handle(), retired(), running(false) { timeline_reset(tl); }
+	sequencer(const sequencer & other) : id(other.id), frame(other.frame), base(0), handle(), retired(), running(false) { timeline_reset(tl); }
+	~sequencer() { if (handle) handle.destroy(); }
+
+	sequencer & operator=(const sequencer & other)
+	{
+		if (handle) handle.destroy();
+
+		id=other.id;
+		frame=other.frame;
+		base=0;
+		handle=nullptr;
+		timeline_reset(tl);
+
+		return *this;
+	}
+};
+
+// Resume the coroutine at a sequence frame. Only the current coroutine is resumed, one which has been
+// replaced while running may still wait, but is never resumed
+inline void
+sequence_resumeat(struct sequencer & seq, std::coroutine_handle<sequence::promise_type> h, const uint64_t frame)
+{
+	if (h!=seq.handle)
+		return;
+
+	timeline_add(seq.tl, frame-seq.base, [h](struct gamestate &) { h.resume(); });
+}
+
+// Resume the coroutine once a condition holds, checking it each frame from the next
+inline void
+sequence_resumewhen(struct sequencer & seq, std::coroutine_handle<sequence::promise_type> h, std::function<bool(const struct gamestate &)> until)
+{
+	if (h!=seq.handle)
+		return;
+
+	timeline_add(seq.tl, (seq.frame+1)-seq.base, [&seq, h, until](struct gamestate & gs)
+	{
+		if (until(gs))
+			h.resume();
+		else
+			sequence_resumewhen(seq, h, until);
+	});
+}
+
+// Wait for the sequence to reach a frame
+struct sequencewait
+{
+	struct sequencer & seq;
+	uint64_t frame;
+
+	bool await_ready() const { return (seq.frame>=frame); }
+	void await_suspend(std::coroutine_handle<sequence::promise_type> h) { sequence_resumeat(seq, h, frame); }
+	void await_resume() const {}
+};
+
+// Wait for a condition to hold, checked once per frame
+struct sequencecondition
+{
+	struct sequencer & seq;
+	const struct gamestate & gs;
+	std::function<bool(const struct gamestate &)> until;
+
+	bool await_ready() const { return until(gs); }
+	void await_suspend(std::coroutine_handle<sequence::promise_type> h) { sequence_resumewhen(seq, h, std::move(until)); }
+	void await_resume() const {}
+};
+
+// Suspend until the next frame
+inline struct sequencewait
+sequence_nextframe(struct sequencer & seq)
+{
+	return {seq, seq.frame+1};
+}
+
+// Suspend until the sequence has run for a number of frames (no wait once they've passed)
+inline struct sequencewait
+sequence_at(struct sequencer & seq, const uint64_t frame)
+{
+	return {seq, frame};
+}
+
+// Suspend until a condition holds
+inline struct sequencecondition
+sequence_until(struct sequencer & seq, const struct gamestate & gs, std::function<bool(const struct gamestate &)> until)
+{
+	return {seq, gs, std::move(until)};
+}
+
+// Start a sequence from its first frame, replacing any running now. One started by a running
+// sequence gets its first step in the same frame
+inline void
+sequence_start(struct sequencer & seq, const uint8_t id)
+{
+	if (seq.handle)
+	{
+		if (seq.running)
+			seq.retired=seq.handle;
+		else
+			seq.handle.destroy();
+	}
+
+	timeline_reset(seq.tl);
+
+	seq.handle=nullptr;
+	seq.id=id;
+	seq.frame=UINT64_MAX;
+}
+
+// Step the running sequence, called once per frame. create builds the coroutine for a sequence id
+inline void
+sequence_step(struct sequencer & seq, struct gamestate & gs, struct sequence (*create)(struct gamestate &, const uint8_t))
+{
+	while (seq.id!=SEQUENCENONE)
+	{
+		seq.frame++;
+
+		// Build the coroutine, its first resume is due now
+		if (!seq.handle)
+		{
+			seq.handle=create(gs, seq.id).handle;
+			seq.base=seq.frame;
+
+			timeline_reset(seq.tl);
+			timeline_begin(seq.tl, 1);
+			sequence_resumeat(seq, seq.handle, seq.frame);
+		}
+
+		std::coroutine_handle<sequence::promise_type> current=seq.handle;
+
+		seq.running=true;
+		timeline_call(seq.tl, gs);
+		seq.running=false;
+
+		// Started another sequence, give that its first step now
+		if (seq.retired)
+		{
+			seq.retired.destroy();
+			seq.retired=nullptr;
+			continue;
+		}
+
+		if (current.done())
+		{
+			current.destroy();
+			seq.handle=nullptr;
+			seq.id=SEQUENCENONE;
+		}
+
+		break;
+	}
+}
+
+#endif // ! defined GUARD_BEEKIND_SEQUENCE_H
@@ -0,0 +1,289 @@
+//=============================================================================
+//	FILE:					tilemap.h
+//	SYSTEM:
+//	DESCRIPTION:	Tile map held as 32x32 chunks, with the chunks in use kept resident
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+
+#ifndef GUARD_BEEKIND_TILEMAP_H
+#define GUARD_BEEKIND_TILEMAP_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#define CHUNKSHIFT 5
+#define CHUNKSIZE (1<<CHUNKSHIFT) // Tiles along each side of a chunk
+#define CHUNKMASK (CHUNKSIZE-1)
+#define CHUNKRESIDENT 64 // Most chunks held resident at once
+
+// Tile map, read in place from its layer. Raw layers (built in tables, or mapped from a level pack) are
+// read directly. RLE packed ones are decoded a chunk at a time into a pool of resident chunks, and any
+// tile of a chunk which isn't resident is decoded from the layer as it's read
+struct tilemap
+{
+	uint32_t width; // Width in tiles
+	uint32_t height; // Height in tiles
+	uint32_t chunkswide; // Width in chunks
+	uint32_t chunkshigh; // Height in chunks
+	const uint8_t *source; // Whole layer, either raw row by row, or RLE packed
+	uint32_t size; // Size of source
+	bool packed; // Source is RLE packed
+	std::vector<uint32_t> segments; // Position in a packed source of each chunk wide part of each row
+	std::vector<uint8_t> skips; // Tiles of the run at that position which belong to the part before
+	std::vector<int32_t> chunks; // Pool slot of each chunk, -1 when not resident
+	std::vector<uint8_t> pool; // Resident chunks, CHUNKSIZE*CHUNKSIZE tiles each
+	std::vector<int32_t> owner; // Chunk held in each pool slot, -1 when free
+	std::vector<uint8_t> wanted; // Chunks wanted this frame, reused by each stream
+};
+
+// Decode count tiles of a packed source into dest, starting offset tiles on from the start of a segment.
+// Past the end of the source reads as 0, as rle_unpack() fills it
+inline void
+tilemap_decode(const struct tilemap & map, const uint32_t segment, uint32_t offset, uint8_t *dest, const uint32_t count)
+{
+	size_t pos=map.segments[segment];
+	uint32_t i=0;
+
+	offset+=map.skips[segment];
+
+	while ((i<count) && (pos<map.size))
+	{
+		uint8_t code=map.source[pos];
+
+		if (code&0x80)
+		{
+			if ((pos+1)>=map.size) break;
+
+			uint32_t run=(code&0x7f)+1;
+
+			if (offset>=run)
+				offset-=run;
+			else
+			{
+				uint8_t value=map.source[pos+1];
+
+				for (; (offset<run) && (i<count); offset++)
+					dest[i++]=value;
+
+				offset=0;
+			}
+
+			pos+=2;
+		}
+		else
+		{
+			if (offset>0)
+				offset--;
+			else
+				dest[i++]=code;
+
+			pos++;
+		}
+	}
+
+	while (i<count)
+		dest[i++]=0;
+}
+
+// Get a tile, x and y must be within the map. Reads don't change the map, so it can be read concurrently
+inline uint8_t
+tilemap_get(const struct tilemap & map, const uint32_t x, const uint32_t y)
+{
+	if (!map.packed)
+		return map.source[((size_t)y*map.width)+x];
+
+	int32_t slot=map.chunks[((y>>CHUNKSHIFT)*map.chunkswide)+(x>>CHUNKSHIFT)];
+
+	if (slot>=0)
+		return map.pool[(slot<<(CHUNKSHIFT*2))+((y&CHUNKMASK)<<CHUNKSHIFT)+(x&CHUNKMASK)];
+
+	uint8_t tile;
+
+	tilemap_decode(map, (y*map.chunkswide)+(x>>CHUNKSHIFT), x&CHUNKMASK, &tile, 1);
+
+	return tile;
+}
+
+// Get a tile by global tile index
+inline uint8_t
+tilemap_at(const struct tilemap & map, const uint32_t index)
+{
+	return tilemap_get(map, index%map.width, index/map.width);
+}
+
+// Copy a whole row into dest, for scanning through the map without holding it all
+inline void
+tilemap_row(const struct tilemap & map, const uint32_t y, uint8_t *dest)
+{
+	if (!map.packed)
+		memcpy(dest, map.source+((size_t)y*map.width), map.width);
+	else
+		tilemap_decode(map, y*map.chunkswide, 0, dest, map.width);
+}
+
+// Decode a chunk from the source into a pool slot
+inline void
+tilemap_fill(struct tilemap & map, const uint32_t chunk, const int32_t slot)
+{
+	uint32_t cx=chunk%map.chunkswide;
+	uint32_t cy=(chunk/map.chunkswide)<<CHUNKSHIFT;
+	uint32_t w=std::min<uint32_t>(CHUNKSIZE, map.width-(cx<<CHUNKSHIFT));
+	uint32_t h=std::min<uint32_t>(CHUNKSIZE, map.height-cy);
+	uint8_t *dest=&map.pool[slot<<(CHUNKSHIFT*2)];
+
+	for (uint32_t y=0; y<h; y++)
+		tilemap_decode(map, ((cy+y)*map.chunkswide)+cx, 0, dest+(y<<CHUNKSHIFT), w);
+
+	map.chunks[chunk]=slot;
+	map.owner[slot]=chunk;
+}
+
+// Set up map to read a layer in place. Packed layers get an index into the runs of each chunk wide part
+// of each row, and their chunks are all made resident when they fit
+inline void
+tilemap_load(struct tilemap & map, const uint8_t *layer, const uint32_t size, const bool packed, const uint32_t width, const uint32_t height)
+{
+	map.width=width;
+	map.height=height;
+	map.chunkswide=(width+CHUNKMASK)>>CHUNKSHIFT;
+	map.chunkshigh=(height+CHUNKMASK)>>CHUNKSHIFT;
+	map.source=layer;
+	map.size=size;
+	map.packed=packed;
+
+	if (!packed)
+	{
+		map.segments.clear();
+		map.skips.clear();
+		map.chunks.clear();
+		map.owner.clear();
+		map.pool.clear();
+		map.wanted.clear();
+
+		return;
+	}
+
+	// Walk the runs once to index them, a run may be split over parts, so note how much of it went before
+	map.segments.resize((size_t)height*map.chunkswide);
+	map.skips.resize(map.segments.size());
+
+	size_t pos=0;
+	uint32_t used=0; // Tiles of the run at pos already passed
+
+	for (uint32_t y=0; y<height; y++)
+	{
+		for (uint32_t cx=0; cx<map.chunkswide; cx++)
+		{
+			uint32_t segment=(y*map.chunkswide)+cx;
+			uint32_t count=std::min<uint32_t>(CHUNKSIZE, width-(cx<<CHUNKSHIFT));
+
+			map.segments[segment]=std::min<size_t>(pos, size);
+			map.skips[segment]=used;
+
+			while ((count>0) && (pos<size))
+			{
+				if (layer[pos]&0x80)
+				{
+					if ((pos+1)>=size)
+					{
+						pos=size;
+						break;
+					}
+
+					uint32_t left=((layer[pos]&0x7f)+1)-used;
+
+					if (count<left)
+					{
+						used+=count;
+						count=0;
+					}
+					else
+					{
+						count-=left;
+						used=0;
+						pos+=2;
+					}
+				}
+				else
+				{
+					count--;
+					pos++;
+				}
+			}
+		}
+	}
+
+	uint32_t numchunks=map.chunkswide*map.chunkshigh;
+
+	map.chunks.assign(numchunks, -1);
+	map.wanted.assign(numchunks, 0);
+	map.owner.assign(std::min<uint32_t>(numchunks, CHUNKRESIDENT), -1);
+	map.pool.resize(map.owner.size()<<(CHUNKSHIFT*2));
+
+	if (numchunks<=CHUNKRESIDENT)
+		for (uint32_t chunk=0; chunk<numchunks; chunk++)
+			tilemap_fill(map, chunk, chunk);
+}
+
+// Check if the map streams, being packed and too big to hold whole
+inline bool
+tilemap_streams(const struct tilemap & map)
+{
+	return (map.owner.size()<map.chunks.size());
+}
+
+// Want the chunk holding a tile kept resident (with those around it), out of map tiles are ignored
+inline void
+tilemap_want(struct tilemap & map, const int32_t x, const int32_t y, const int32_t margin)
+{
+	int32_t cx=x>>CHUNKSHIFT;
+	int32_t cy=y>>CHUNKSHIFT;
+
+	for (int32_t wy=std::max(cy-margin, 0); wy<=std::min<int32_t>(cy+margin, map.chunkshigh-1); wy++)
+		for (int32_t wx=std::max(cx-margin, 0); wx<=std::min<int32_t>(cx+margin, map.chunkswide-1); wx++)
+			map.wanted[(wy*map.chunkswide)+wx]=1;
+}
+
+// Make the wanted chunks resident as far as the pool allows, dropping unwanted ones, then clear wants
+inline void
+tilemap_stream(struct tilemap & map)
+{
+	// Everything is already resident, or read straight from a raw layer
+	if (!tilemap_streams(map))
+		return;
+
+	// Free slots of chunks no longer wanted
+	for (uint32_t slot=0; slot<map.owner.size(); slot++)
+	{
+		if ((map.owner[slot]>=0) && (!map.wanted[map.owner[slot]]))
+		{
+			map.chunks[map.owner[slot]]=-1;
+			map.owner[slot]=-1;
+		}
+	}
+
+	// Fill free slots with wanted chunks which aren't resident
+	uint32_t slot=0;
+
+	for (uint32_t chunk=0; chunk<map.chunks.size(); chunk++)
+	{
+		if ((map.wanted[chunk]) && (map.chunks[chunk]<0))
+		{
+			while ((slot<map.owner.size()) && (map.owner[slot]>=0))
+				slot++;
+
+			if (slot>=map.owner.size())
+				break;
+
+			tilemap_fill(map, chunk, slot);
+		}
+	}
+
+	std::fill(map.wanted.begin(), map.wanted.end(), 0);
+}
+
+#endif // ! defined GUARD_BEEKIND_TILEMAP_H
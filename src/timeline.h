@@ -1,95 +1,87 @@
-// Timeline object
+#ifndef GUARD_BEEKIND_TIMELINE_H
+#define GUARD_BEEKIND_TIMELINE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+struct gamestate;
+
+// Timeline object, items are kept in frame order with a cursor at the next one to run.
+// Each object is independent, so any number of them can run side by side.
 
 struct timelineitem
 {
 	uint64_t frame; // Frame count to execute this item
-	void (*func)(); // Function to run
-	bool done; // If this has been run
+	std::function<void(struct gamestate &)> func; // Function to run, can capture
 };
 
 struct timelineobj
 {
-	std::vector<struct timelineitem> timeline; // Array of actions
+	std::vector<struct timelineitem> timeline; // Array of actions, in frame order
+	size_t cursor; // Next action to run, those before it are done
 	uint64_t timelinepos; // Current frame counter
-	void (*callback)(float); // Optional callback on each timeline "tick"
+	std::function<void(struct gamestate &, float)> callback; // Optional callback on each timeline "tick"
 	bool running; // Start in non-running state
 	uint64_t looped; // Completed iterations
 	uint64_t loop; // Number of times to loop, 0 means infinite
 };
 
-struct timelineobj tl;
-
-// Add a new function to timeline with a given start time
-void
-timeline_add(const uint64_t itemstart, void (*newitem)())
+// Add a new function to timeline with a given start time, after any others due at the same time
+inline void
+timeline_add(struct timelineobj & tl, const uint64_t itemstart, std::function<void(struct gamestate &)> newitem)
 {
-	struct timelineitem item;
-
-	item.frame=itemstart;
-	item.func=newitem;
-	item.done=false;
-
-	tl.timeline.push_back(item);
+	auto pos=std::upper_bound(tl.timeline.begin()+tl.cursor, tl.timeline.end(), itemstart,
+		[](const uint64_t frame, const struct timelineitem & item) { return frame<item.frame; });
 
-	// TODO - sort timeline into frame-stamp order ??
+	tl.timeline.insert(pos, {itemstart, std::move(newitem)});
 }
 
 // Add a timeline callback
-void
-timeline_addcallback(void (*callback)(float))
+inline void
+timeline_addcallback(struct timelineobj & tl, std::function<void(struct gamestate &, float)> callback)
 {
-	tl.callback=callback;
+	tl.callback=std::move(callback);
 }
 
-// Called once per frame
-void
-timeline_call()
+// Called once per frame, only looks at the items which are due
+inline void
+timeline_call(struct timelineobj & tl, struct gamestate & gs)
 {
-	uint64_t remain=0; // Tasks left to run, to determine when we are done
-
 	// Stop further processing if we're not running
 	if (!tl.running) return;
 
-	// Look through timeline array for jobs not run which should have
-	for (uint64_t i=0; i<tl.timeline.size(); i++)
+	// Run jobs which are due, moving past each first as it may add to (or reset) the timeline
+	while ((tl.cursor<tl.timeline.size()) && (tl.timeline[tl.cursor].frame<=tl.timelinepos))
 	{
-		if ((!tl.timeline[i].done) && (tl.timeline[i].frame<=tl.timelinepos))
-		{
-			tl.timeline[i].done=true;
-
-			// Only call function if it is defined
-			if (tl.timeline[i].func!=NULL)
-				tl.timeline[i].func();
-		}
+		std::function<void(struct gamestate &)> func=tl.timeline[tl.cursor++].func;
 
-		// Keep a count of all remaining jobs if still running
-		if ((tl.running==true) && ((tl.timeline.size()-1)>=i) && (!tl.timeline[i].done))
-			remain++;
+		// Only call function if it is defined
+		if (func)
+			func(gs);
 	}
 
 	// If a callback was requested, then call it
-	if (tl.callback!=NULL)
+	if (tl.callback)
 	{
 		// If there's only a single NULL function on the timeline and it doesn't start at 0, then call with percentage
-		if ((tl.timeline.size()==1) && (tl.timeline[0].func==NULL) && (tl.timeline[0].frame>0))
-			tl.callback(((float)tl.timelinepos/(float)tl.timeline[0].frame)*100); // percentage complete
+		if ((tl.timeline.size()==1) && (!tl.timeline[0].func) && (tl.timeline[0].frame>0))
+			tl.callback(gs, ((float)tl.timelinepos/(float)tl.timeline[0].frame)*100); // percentage complete
 		else
-			tl.callback(0.0);
+			tl.callback(gs, 0.0);
 	}
 
 	// Check for timeline being complete
-	if (remain==0)
+	if (tl.cursor>=tl.timeline.size())
 	{
 		tl.looped++;
 
-		// Check for more iterations required
+		// Check for more iterations required, rewinding the cursor is all it takes to loop
 		if ((tl.loop==0) || (tl.looped<tl.loop))
 		{
 			tl.timelinepos=0;
-
-			// Look through timeline, resetting done flag
-			for (uint64_t j=0; j<tl.timeline.size(); j++)
-				tl.timeline[j].done=false;
+			tl.cursor=0;
 		}
 		else
 			tl.running=false;
@@ -99,32 +91,36 @@ timeline_call()
 }
 
 // Start the timeline running
-void
-timeline_begin(const uint64_t loops)
+inline void
+timeline_begin(struct timelineobj & tl, const uint64_t loops)
 {
 	tl.looped=0;
 	tl.loop=loops;
 	tl.timelinepos=0;
+	tl.cursor=0;
 
 	tl.running=true;
 }
 
 // Stop the timeline running
-void
-timeline_end()
+inline void
+timeline_end(struct timelineobj & tl)
 {
 	tl.running=false;
 }
 
 // Reset the timeline to be used again
-void
-timeline_reset()
+inline void
+timeline_reset(struct timelineobj & tl)
 {
 	tl.running=false; // Start in non-running state
 
 	tl.timeline.clear(); // Array of actions
+	tl.cursor=0; // Next action to run
 	tl.timelinepos=0; // Frame count
-	tl.callback=NULL; // Optional callback on each timeline "tick"
+	tl.callback=nullptr; // Optional callback on each timeline "tick"
 	tl.looped=0; // Completed iterations
 	tl.loop=1; // Number of times to loop, 0 means infinite
 }
+
+#endif // ! defined GUARD_BEEKIND_TIMELINE_H
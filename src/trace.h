@@ -0,0 +1,151 @@
+//=============================================================================
+//	FILE:					trace.h
+//	SYSTEM:
+//	DESCRIPTION:	Optional trace-event recording, dumped as Chrome trace JSON
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_TRACE_H
+#define GUARD_BEEKIND_TRACE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// A single recorded event, names must be string literals as only the
+// pointer is kept
+struct traceevent
+{
+	const char *name; // Event name
+	const char *argname; // Name of optional argument, or NULL
+	uint64_t ts; // Timestamp (us)
+	int64_t arg; // Argument or counter value
+	char ph; // Chrome phase, 'B'egin, 'E'nd or 'C'ounter
+};
+
+// Fixed size ring of events, once full the oldest are overwritten
+struct tracebuffer
+{
+	uint64_t (*clock)(); // Microsecond clock
+	std::vector<struct traceevent> events; // Ring of events
+	uint32_t pos; // Next event to write
+	uint32_t count; // Number of events held
+};
+
+// Allocate a buffer for capacity events
+inline void
+trace_reset(struct tracebuffer & trace, const uint32_t capacity, uint64_t (*clock)())
+{
+	trace.clock=clock;
+	trace.events.assign(capacity, {});
+	trace.pos=0;
+	trace.count=0;
+}
+
+inline void
+trace_add(struct tracebuffer & trace, const char ph, const char *name, const char *argname, const int64_t arg)
+{
+	struct traceevent & ev=trace.events[trace.pos];
+
+	ev.name=name;
+	ev.argname=argname;
+	ev.ts=trace.clock();
+	ev.arg=arg;
+	ev.ph=ph;
+
+	trace.pos=(trace.pos+1)%trace.events.size();
+	if (trace.count<trace.events.size()) trace.count++;
+}
+
+// Write events out as Chrome trace JSON, viewable in chrome://tracing or Perfetto
+inline bool
+trace_write(const struct tracebuffer & trace, const char *filename)
+{
+	FILE *fp=fopen(filename, "w");
+
+	if (fp==NULL)
+		return false;
+
+	fprintf(fp, "{\"traceEvents\":[\n");
+
+	for (uint32_t i=0; i<trace.count; i++)
+	{
+		const struct traceevent & ev=trace.events[(trace.pos+trace.events.size()-trace.count+i)%trace.events.size()];
+
+		fprintf(fp, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":1", ev.name, ev.ph, (unsigned long long)ev.ts);
+
+		if (ev.ph=='C')
+			fprintf(fp, ",\"args\":{\"value\":%lld}", (long long)ev.arg);
+		else
+		if (ev.argname!=NULL)
+			fprintf(fp, ",\"args\":{\"%s\":%lld}", ev.argname, (long long)ev.arg);
+
+		fprintf(fp, "}%s\n", ((i+1)<trace.count)?",":"");
+	}
+
+	fprintf(fp, "]}\n");
+	fclose(fp);
+
+	return true;
+}
+
+// Set on threads helping a game out (such as AI workers), which don't record as the
+// buffer is only written by the game's own thread
+inline thread_local bool sg_tracehelper=false;
+
+// Mark this thread as a helper, or not, for the enclosing scope
+struct tracehelperscope
+{
+	bool previous;
+
+	tracehelperscope(const bool helper) :
+		previous(sg_tracehelper)
+	{
+		sg_tracehelper=helper;
+	}
+
+	~tracehelperscope()
+	{
+		sg_tracehelper=previous;
+	}
+};
+
+// Records begin and end events around the enclosing scope, set arg before
+// the scope ends to attach a value to the end event
+struct tracescope
+{
+	struct tracebuffer *trace;
+	const char *name;
+	const char *argname;
+	int64_t arg;
+
+	tracescope(struct tracebuffer *t, const char *n, const char *an=NULL) :
+		trace(sg_tracehelper?NULL:t), name(n), argname(an), arg(0)
+	{
+		if (trace!=NULL)
+			trace_add(*trace, 'B', name, NULL, 0);
+	}
+
+	~tracescope()
+	{
+		if (trace!=NULL)
+			trace_add(*trace, 'E', name, argname, arg);
+	}
+};
+
+// Tracing is compiled out unless BEEKIND_TRACE is defined, and then only
+// records when the game has been given a buffer
+#if defined(BEEKIND_TRACE)
+#define TRACE_SCOPE(GS, NAME) struct tracescope tracescope_(GS.trace, NAME)
+#define TRACE_SCOPE_ARG(GS, NAME, ARGNAME) struct tracescope tracescope_(GS.trace, NAME, ARGNAME)
+#define TRACE_ARG(VALUE) (tracescope_.arg=(VALUE))
+#define TRACE_COUNTER(GS, NAME, VALUE) do { if ((GS.trace!=NULL) && (!sg_tracehelper)) trace_add(*GS.trace, 'C', NAME, NULL, VALUE); } while (0)
+#else
+#define TRACE_SCOPE(GS, NAME)
+#define TRACE_SCOPE_ARG(GS, NAME, ARGNAME)
+#define TRACE_ARG(VALUE)
+#define TRACE_COUNTER(GS, NAME, VALUE)
+#endif
+
+#endif // ! defined GUARD_BEEKIND_TRACE_H
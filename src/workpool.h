@@ -0,0 +1,189 @@
+//=============================================================================
+//	FILE:					workpool.h
+//	SYSTEM:
+//	DESCRIPTION:	Work stealing thread pool, for running a job over chunks in parallel
+//-----------------------------------------------------------------------------
+//  COPYRIGHT:		(C)Copyright 2022 Jasper Renow-Clarke. All Rights Reserved.
+//	LICENCE:			MIT
+//=============================================================================
+#ifndef GUARD_BEEKIND_WORKPOOL_H
+#define GUARD_BEEKIND_WORKPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define WORKPOOLMAX 64 // Most workers in a pool, counting the thread running jobs
+
+// Chunks still to do by one worker, front in the low half and back in the high half. The owner takes
+// from the front, others steal from the back
+struct alignas(64) workqueue
+{
+	std::atomic<uint64_t> range;
+};
+
+// Pool of threads which help whichever thread runs a job, which is worker 0. Only runs one job at once
+struct workpool
+{
+	uint32_t numworkers; // Workers, counting the thread running jobs
+	std::vector<std::thread> threads; // Helper threads, workers 1 onwards
+	std::unique_ptr<struct workqueue[]> queues; // Chunks of the current job for each worker
+	std::function<void(const uint32_t, const uint32_t)> job; // Current job, given the worker and chunk
+	std::mutex lock;
+	std::condition_variable wake; // Helpers wait on this for a job
+	std::condition_variable done; // Job runner waits on this for helpers to finish
+	uint64_t generation; // Number of jobs started, for helpers to spot a new one
+	uint32_t busy; // Helpers yet to finish the current job
+	bool quit; // Helpers should exit
+};
+
+// Take a chunk from a queue, from the back when stealing. Returns false once it's empty
+inline bool
+workpool_take(struct workqueue & queue, const bool steal, uint32_t & chunk)
+{
+	uint64_t range=queue.range.load(std::memory_order_acquire);
+
+	for (;;)
+	{
+		uint32_t front=(uint32_t)range;
+		uint32_t back=(uint32_t)(range>>32);
+
+		if (front>=back)
+			return false;
+
+		uint64_t taken=steal?((((uint64_t)(back-1))<<32)|front):(((uint64_t)back<<32)|(front+1));
+
+		if (queue.range.compare_exchange_weak(range, taken, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			chunk=steal?(back-1):front;
+
+			return true;
+		}
+	}
+}
+
+// Work through own chunks, then steal from the other workers until there's none left
+inline void
+workpool_work(struct workpool & pool, const uint32_t worker)
+{
+	uint32_t chunk;
+
+	while (workpool_take(pool.queues[worker], false, chunk))
+		pool.job(worker, chunk);
+
+	for (uint32_t n=1; n<pool.numworkers; n++)
+	{
+		struct workqueue & victim=pool.queues[(worker+n)%pool.numworkers];
+
+		while (workpool_take(victim, true, chunk))
+			pool.job(worker, chunk);
+	}
+}
+
+inline void
+workpool_helper(struct workpool & pool, const uint32_t worker)
+{
+	uint64_t seen=0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> guard(pool.lock);
+
+			pool.wake.wait(guard, [&]() { return (pool.quit) || (pool.generation!=seen); });
+
+			if (pool.quit)
+				return;
+
+			seen=pool.generation;
+		}
+
+		workpool_work(pool, worker);
+
+		std::lock_guard<std::mutex> guard(pool.lock);
+
+		if (--pool.busy==0)
+			pool.done.notify_one();
+	}
+}
+
+// Start a pool of workers (counting the thread which runs jobs), 1 or less runs jobs serially
+inline void
+workpool_start(struct workpool & pool, const uint32_t workers)
+{
+	pool.numworkers=std::min<uint32_t>(std::max<uint32_t>(workers, 1), WORKPOOLMAX);
+	pool.queues.reset(new struct workqueue[pool.numworkers]);
+	pool.generation=0;
+	pool.busy=0;
+	pool.quit=false;
+
+	for (uint32_t w=0; w<pool.numworkers; w++)
+		pool.queues[w].range.store(0);
+
+	for (uint32_t w=1; w<pool.numworkers; w++)
+		pool.threads.emplace_back(workpool_helper, std::ref(pool), w);
+}
+
+inline void
+workpool_stop(struct workpool & pool)
+{
+	{
+		std::lock_guard<std::mutex> guard(pool.lock);
+
+		pool.quit=true;
+	}
+
+	pool.wake.notify_all();
+
+	for (uint32_t t=0; t<pool.threads.size(); t++)
+		pool.threads[t].join();
+
+	pool.threads.clear();
+	pool.numworkers=1;
+}
+
+// Run job over chunks, returning once they're all done. Chunks are shared out evenly in runs to start
+// with, then workers which run out steal from the others
+inline void
+workpool_run(struct workpool & pool, const uint32_t chunks, std::function<void(const uint32_t, const uint32_t)> job)
+{
+	if ((pool.numworkers<=1) || (chunks<=1))
+	{
+		for (uint32_t chunk=0; chunk<chunks; chunk++)
+			job(0, chunk);
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(pool.lock);
+
+		for (uint32_t w=0; w<pool.numworkers; w++)
+		{
+			uint64_t front=((uint64_t)chunks*w)/pool.numworkers;
+			uint64_t back=((uint64_t)chunks*(w+1))/pool.numworkers;
+
+			pool.queues[w].range.store((back<<32)|front, std::memory_order_relaxed);
+		}
+
+		pool.job=std::move(job);
+		pool.busy=pool.numworkers-1;
+		pool.generation++;
+	}
+
+	pool.wake.notify_all();
+
+	workpool_work(pool, 0);
+
+	std::unique_lock<std::mutex> guard(pool.lock);
+
+	pool.done.wait(guard, [&]() { return (pool.busy==0); });
+}
+
+#endif // ! defined GUARD_BEEKIND_WORKPOOL_H